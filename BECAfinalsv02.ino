@@ -74,6 +74,23 @@ volatile bool gIoMuted = false;
 
 beca::SynthEngine gSynth;
 uint32_t gLastSynthUnderrunLogMs = 0;
+// I2S latency profile (beca::SynthLatency), kept in NVS as "latency".
+uint8_t gSynthLatency = beca::SYNTH_LATENCY_NORMAL;
+// Real-time audio mode, kept in NVS as "realtime". See controlPass().
+bool gRealtimeAudio = false;
+// Second-core voice rendering, kept in NVS as "parallel".
+bool gParallelVoices = false;
+SemaphoreHandle_t gControlLock = nullptr;
+// In real-time mode a control pass that has run this long skips its LED
+// frame and SSE streaming; they run on the next pass, about 1 ms later.
+const uint32_t CONTROL_PASS_BUDGET_US = 4000;
+uint32_t gControlPassMaxUs = 0;
+uint32_t gControlWebMaxUs = 0;
+uint32_t gControlDeferred = 0;
+// Scheduled time of the transport step being played. Synth notes are stamped
+// with it so they keep the grid and swing even when loop() reaches the step late.
+uint32_t gStepStampMs = 0;
+bool gStepStampValid = false;
 
 // --- BLE advertising keepalive ---
 uint32_t gLastBleKickMs = 0;
@@ -90,8 +107,7 @@ static inline uint32_t auxSwitchWaitMs() {
   if (auxSwitchReady()) return 0;
   return gAuxUnlockAtMs - millis();
 }
-static inline bool drumsAllowedForCurrentOutput();
-static inline void enforceAuxDrumGuard();
+static void controlTask(void*);
 
 static inline void serialMidiSend3(uint8_t st, uint8_t d1, uint8_t d2) {
   char line[24];
@@ -234,7 +250,8 @@ static inline const char* outputModeName(uint8_t mode) {
 static inline bool startAuxAudio() {
   if (ioMuteActive()) return true;
   if (gSynth.running()) return true;
-  const bool ok = gSynth.start(I2S_BCK_PIN, I2S_WS_PIN, I2S_DATA_PIN, 44100, 128);
+  gSynth.setRealtime(gRealtimeAudio);
+  const bool ok = gSynth.start(I2S_BCK_PIN, I2S_WS_PIN, I2S_DATA_PIN, 44100, gSynthLatency);
   if (ok) {
     gSynth.fadeIn(24);
     Serial.println("@I I2S START OK");
@@ -269,11 +286,7 @@ static inline void applyIoMute(bool muteOn) {
   }
 
   Serial.println("@I IO MUTE OFF");
-  if (outputModeIsAux()) {
-    enforceAuxDrumGuard();
-    gSynth.setDrumsEnabled(false);
-    startAuxAudio();
-  }
+  if (outputModeIsAux()) startAuxAudio();
 }
 
 static inline void setOutputMode(uint8_t mode) {
@@ -298,14 +311,10 @@ static inline void setOutputMode(uint8_t mode) {
   gOutputMode = next;
 
   if (outputModeIsAux()) {
-    enforceAuxDrumGuard();
-    gSynth.setDrumsEnabled(false);
     if (!ioMuteActive()) startAuxAudio();
     return;
   }
 
-  gSynth.setDrumsEnabled(true);
-
   if (outputModeIsSerial()) {
     gLastSerialBeaconMs = 0;
     Serial.println("@I MIDIMODE SERIAL");
@@ -414,14 +423,6 @@ Transport T;
 enum Mode { MODE_NOTE = 0, MODE_ARP = 1, MODE_CHORD = 2, MODE_DRUM = 3 };
 Mode gMode = MODE_CHORD;
 
-static inline bool drumsAllowedForCurrentOutput() { return !outputModeIsAux(); }
-static inline void enforceAuxDrumGuard() {
-  if (!drumsAllowedForCurrentOutput() && gMode == MODE_DRUM) {
-    gMode = MODE_NOTE;
-    Serial.println("@I AUX DRUM MODE BLOCKED -> NOTES");
-  }
-}
-
 uint8_t rootMidi = 60; // stored as MIDI, we expose root "semi" in UI via rootMidi%12
 uint8_t lowOct   = 3;
 uint8_t highOct  = 6;
@@ -552,7 +553,8 @@ static inline void sendMelodic(uint8_t note, uint8_t vel = 96, uint8_t ch = 1, u
   uiQueueHeldNote(note, gateMs);
 
   if (outputModeIsAux()) {
-    gSynth.noteOn(note, vel, gateMs);
+    const uint32_t at = gStepStampValid ? gSynth.sampleTimeAt(gStepStampMs * 1000u) : gSynth.sampleTimeNow();
+    gSynth.noteOnAt(at, note, vel, gateMs);
   } else if (midiOutReady()) {
     midiSendNoteOn(note, vel, ch);
     queueNoteOff(note, ch, gateMs);
@@ -568,14 +570,19 @@ static inline void sendMelodic(uint8_t note, uint8_t vel = 96, uint8_t ch = 1, u
 // drums also light drum-grid + extend hold window (for feel)
 static inline void sendDrum(uint8_t note, uint8_t vel = 110, uint16_t gateMs = 60) {
   if (ioMuteActive()) return;
-  if (!drumsAllowedForCurrentOutput()) return;
   int8_t part = drumPartFromNote(note);
   if (part >= 0) {
     // respect selection mask
     if (((uint8_t)drumSelMask & (1u << (uint8_t)part)) == 0) return;
   }
 
-  if (midiOutReady()) {
+  // AUX plays the onboard kit; its part numbers follow the DP_ order.
+  if (outputModeIsAux()) {
+    if (part >= 0) {
+      const uint32_t at = gStepStampValid ? gSynth.sampleTimeAt(gStepStampMs * 1000u) : gSynth.sampleTimeNow();
+      gSynth.drumHitAt(at, (uint8_t)part, vel);
+    }
+  } else if (midiOutReady()) {
     midiSendNoteOn(note, vel, DRUM_CH);
     queueNoteOff(note, DRUM_CH, gateMs);
   }
@@ -1096,10 +1103,6 @@ static inline void stepCHORD_internal() {
 }
 
 static inline void stepDRUM_internal() {
-  if (!drumsAllowedForCurrentOutput()) {
-    stepNOTE_internal();
-    return;
-  }
   float fd, fo, e; uint8_t vel;
   samplePlant(fd, fo, vel, e);
 
@@ -1181,11 +1184,6 @@ static inline void step_fromPlantTrigger() {
     } break;
 
     case MODE_DRUM: {
-      if (!drumsAllowedForCurrentOutput()) {
-        sendMelodic(note, vel, 1, gate);
-        lastMidiOut = note;
-        break;
-      }
       // Plant-triggered "hit" can play multiple parts depending on energy,
       // but still respects drumSelMask.
       uint8_t kickVel  = (uint8_t)max((int)80, (int)vel);
@@ -1249,6 +1247,9 @@ uint32_t lastNoteHash = 0;
 uint32_t lastSseDrumMs = 0;
 uint32_t lastDrumHash = 0;
 
+// Synth CPU meter SSE throttle
+uint32_t lastSseStatsMs = 0;
+
 // lifetime prevents browsers keeping dead sockets forever
 const uint32_t SSE_MAX_LIFETIME_MS = 180000;
 
@@ -1330,6 +1331,7 @@ static inline void handleEvents() {
   lastNoteHash = 0;
   lastSseDrumMs = 0;
   lastDrumHash = 0;
+  lastSseStatsMs = 0;
 
   sseClient.println("HTTP/1.1 200 OK");
   sseClient.println("Content-Type: text/event-stream");
@@ -1562,9 +1564,7 @@ static inline void setHighOct() {
 
 static inline void setMode() {
   if (server.hasArg("i")) {
-    Mode next = (Mode)constrain(server.arg("i").toInt(), 0, 3);
-    if (!drumsAllowedForCurrentOutput() && next == MODE_DRUM) next = MODE_NOTE;
-    gMode = next;
+    gMode = (Mode)constrain(server.arg("i").toInt(), 0, 3);
   }
   pushStateIfChanged(true);
   server.send(200, "text/plain", "OK");
@@ -1702,6 +1702,10 @@ static inline void handleApiMutePost() {
 
 static inline void handleApiSynthGet() {
   beca::SynthParams p;
+  unsigned userMask = 0;
+  for (uint8_t slot = 0; slot < beca::SynthEngine::kUserPresetCount; ++slot) {
+    if (gSynth.userPreset(slot, p)) userMask |= 1u << slot;
+  }
   gSynth.getParams(p);
   char buf[512];
   snprintf(
@@ -1710,59 +1714,342 @@ static inline void handleApiSynthGet() {
     "\"mono\":%u,\"voices\":%u,\"attack\":%.3f,\"decay\":%.3f,\"sustain\":%.3f,\"release\":%.3f,"
     "\"filter\":%u,\"cutoff\":%.2f,\"resonance\":%.3f,\"reverb\":%.3f,\"delay_ms\":%.2f,"
     "\"delay_feedback\":%.3f,\"delay_mix\":%.3f,\"drive\":%.3f,\"master\":%.3f,\"detune\":%.3f,"
-    "\"gain_trim\":%.3f,\"drumkit\":%u}",
+    "\"gain_trim\":%.3f,\"drumkit\":%u,\"env_curve\":%u,\"user_presets\":%u}",
     (unsigned)p.preset, beca::SynthEngine::presetName(p.preset),
     (unsigned)p.waveA, (unsigned)p.waveB, (double)p.oscMix,
     (unsigned)p.mono, (unsigned)p.maxVoices, (double)p.attack, (double)p.decay, (double)p.sustain, (double)p.release,
     (unsigned)p.filterType, (double)p.cutoffHz, (double)p.resonance, (double)p.reverb, (double)p.delayMs,
     (double)p.delayFeedback, (double)p.delayMix, (double)p.distDrive, (double)p.master, (double)p.detuneCents,
-    (double)p.gainTrim, (unsigned)p.drumKit
+    (double)p.gainTrim, (unsigned)p.drumKit, (unsigned)p.envCurve, (unsigned)userMask
   );
   sendNoCacheHeaders();
   server.send(200, "application/json", buf);
 }
 
-static inline void handleApiSynthPost() {
+// Form field -> synth parameter. Only the fields a request names are written,
+// and the engine clamps each one, so a slider moving one value never
+// republishes (or glides) the rest.
+struct SynthParamArg {
+  const char* name;
+  uint8_t id;
+};
+
+static const SynthParamArg kSynthParamArgs[] = {
+  { "wave_a", beca::SYNTH_PARAM_WAVE_A },
+  { "wave_b", beca::SYNTH_PARAM_WAVE_B },
+  { "osc_mix", beca::SYNTH_PARAM_OSC_MIX },
+  { "mono", beca::SYNTH_PARAM_MONO },
+  { "voices", beca::SYNTH_PARAM_MAX_VOICES },
+  { "attack", beca::SYNTH_PARAM_ATTACK },
+  { "decay", beca::SYNTH_PARAM_DECAY },
+  { "sustain", beca::SYNTH_PARAM_SUSTAIN },
+  { "release", beca::SYNTH_PARAM_RELEASE },
+  { "filter", beca::SYNTH_PARAM_FILTER_TYPE },
+  { "cutoff", beca::SYNTH_PARAM_CUTOFF },
+  { "resonance", beca::SYNTH_PARAM_RESONANCE },
+  { "reverb", beca::SYNTH_PARAM_REVERB },
+  { "delay_ms", beca::SYNTH_PARAM_DELAY_MS },
+  { "delay_feedback", beca::SYNTH_PARAM_DELAY_FEEDBACK },
+  { "delay_mix", beca::SYNTH_PARAM_DELAY_MIX },
+  { "drive", beca::SYNTH_PARAM_DRIVE },
+  { "master", beca::SYNTH_PARAM_MASTER },
+  { "detune", beca::SYNTH_PARAM_DETUNE },
+  { "gain_trim", beca::SYNTH_PARAM_GAIN_TRIM },
+  { "drumkit", beca::SYNTH_PARAM_DRUM_KIT },
+  { "env_curve", beca::SYNTH_PARAM_ENV_CURVE },
+};
+
+// User preset slots persist in NVS as raw SynthParams ("usr0".."usr3"). The
+// engine clamps them again on restore, and a blob of the wrong size (an older
+// layout) is skipped.
+static void userPresetKey(uint8_t slot, char* key, size_t len) {
+  snprintf(key, len, "usr%u", (unsigned)slot);
+}
+
+static bool saveUserPresetSlot(uint8_t slot) {
   beca::SynthParams p;
   gSynth.getParams(p);
+  if (!gSynth.storeUserPreset(slot, p)) return false;
+  gSynth.userPreset(slot, p);
+  char key[8];
+  userPresetKey(slot, key, sizeof(key));
+  prefs.begin("beca", false);
+  prefs.putBytes(key, &p, sizeof(p));
+  prefs.end();
+  return true;
+}
+
+static void restoreUserPresets() {
+  prefs.begin("beca", true);
+  for (uint8_t slot = 0; slot < beca::SynthEngine::kUserPresetCount; ++slot) {
+    char key[8];
+    userPresetKey(slot, key, sizeof(key));
+    beca::SynthParams p;
+    if (prefs.getBytesLength(key) != sizeof(p)) continue;
+    if (prefs.getBytes(key, &p, sizeof(p)) == sizeof(p)) gSynth.storeUserPreset(slot, p);
+  }
+  prefs.end();
+}
+
+// User drum kits persist in NVS as kit blobs ("kit0".."kit3"), so a layout
+// change in DrumKitDef does not invalidate them; blobs that do not parse are
+// skipped.
+static bool saveUserDrumKit(uint8_t slot) {
+  beca::DrumKitDef kit;
+  if (!gSynth.drumKit(beca::DrumEngine::kFactoryKitCount + slot, kit)) return false;
+  uint8_t blob[beca::DrumEngine::kKitBlobBytes];
+  beca::DrumEngine::writeKitBlob(kit, blob);
+  char key[8];
+  snprintf(key, sizeof(key), "kit%u", (unsigned)slot);
+  prefs.begin("beca", false);
+  prefs.putBytes(key, blob, sizeof(blob));
+  prefs.end();
+  return true;
+}
+
+static void restoreUserDrumKits() {
+  prefs.begin("beca", true);
+  for (uint8_t slot = 0; slot < beca::DrumEngine::kUserKitCount; ++slot) {
+    char key[8];
+    snprintf(key, sizeof(key), "kit%u", (unsigned)slot);
+    uint8_t blob[beca::DrumEngine::kKitBlobBytes];
+    beca::DrumKitDef kit;
+    const size_t len = prefs.getBytesLength(key);
+    if (len == 0 || len > sizeof(blob)) continue;
+    if (prefs.getBytes(key, blob, len) == len && beca::DrumEngine::parseKitBlob(blob, len, kit)) {
+      gSynth.storeDrumKit(slot, kit);
+    }
+  }
+  prefs.end();
+}
 
+static inline void handleApiSynthPost() {
   if (server.hasArg("preset")) {
-    const uint8_t idx = (uint8_t)constrain(server.arg("preset").toInt(), 0, (int)beca::SynthEngine::kPresetCount - 1);
-    p.preset = idx;
-    gSynth.loadPreset(idx);
-    gSynth.getParams(p);
+    gSynth.loadPreset((uint8_t)constrain(server.arg("preset").toInt(), 0, (int)beca::SynthEngine::kPresetCount - 1));
+  }
+  if (server.hasArg("user_load")) {
+    if (!gSynth.loadUserPreset((uint8_t)constrain(server.arg("user_load").toInt(), 0, 255))) {
+      server.send(400, "application/json", "{\"ok\":0,\"err\":\"user preset slot empty\"}");
+      return;
+    }
   }
   if (server.hasArg("reset") && server.arg("reset").toInt() != 0) {
     gSynth.resetPreset();
-    gSynth.getParams(p);
-  }
-
-  if (server.hasArg("wave_a")) p.waveA = (uint8_t)constrain(server.arg("wave_a").toInt(), 0, 3);
-  if (server.hasArg("wave_b")) p.waveB = (uint8_t)constrain(server.arg("wave_b").toInt(), 0, 3);
-  if (server.hasArg("osc_mix")) p.oscMix = server.arg("osc_mix").toFloat();
-  if (server.hasArg("mono")) p.mono = (server.arg("mono").toInt() != 0) ? 1 : 0;
-  if (server.hasArg("voices")) p.maxVoices = (uint8_t)constrain(server.arg("voices").toInt(), 1, 12);
-  if (server.hasArg("attack")) p.attack = server.arg("attack").toFloat();
-  if (server.hasArg("decay")) p.decay = server.arg("decay").toFloat();
-  if (server.hasArg("sustain")) p.sustain = server.arg("sustain").toFloat();
-  if (server.hasArg("release")) p.release = server.arg("release").toFloat();
-  if (server.hasArg("filter")) p.filterType = (uint8_t)constrain(server.arg("filter").toInt(), 0, 2);
-  if (server.hasArg("cutoff")) p.cutoffHz = server.arg("cutoff").toFloat();
-  if (server.hasArg("resonance")) p.resonance = server.arg("resonance").toFloat();
-  if (server.hasArg("reverb")) p.reverb = server.arg("reverb").toFloat();
-  if (server.hasArg("delay_ms")) p.delayMs = server.arg("delay_ms").toFloat();
-  if (server.hasArg("delay_feedback")) p.delayFeedback = server.arg("delay_feedback").toFloat();
-  if (server.hasArg("delay_mix")) p.delayMix = server.arg("delay_mix").toFloat();
-  if (server.hasArg("drive")) p.distDrive = server.arg("drive").toFloat();
-  if (server.hasArg("master")) p.master = server.arg("master").toFloat();
-  if (server.hasArg("detune")) p.detuneCents = server.arg("detune").toFloat();
-  if (server.hasArg("gain_trim")) p.gainTrim = server.arg("gain_trim").toFloat();
-  if (server.hasArg("drumkit")) p.drumKit = (uint8_t)constrain(server.arg("drumkit").toInt(), 0, 2);
-
-  gSynth.setParams(p);
+  }
+
+  for (size_t i = 0; i < sizeof(kSynthParamArgs) / sizeof(kSynthParamArgs[0]); ++i) {
+    const SynthParamArg& a = kSynthParamArgs[i];
+    if (server.hasArg(a.name)) gSynth.setParam(a.id, server.arg(a.name).toFloat());
+  }
+  if (server.hasArg("user_save")) {
+    if (!saveUserPresetSlot((uint8_t)constrain(server.arg("user_save").toInt(), 0, 255))) {
+      server.send(400, "application/json", "{\"ok\":0,\"err\":\"bad user preset slot\"}");
+      return;
+    }
+  }
   handleApiSynthGet();
 }
 
+// Audio render timing and load governor state (see beca::SynthStats).
+// ?reset=1 clears the counters after reading, ?governor=0|1 switches the governor.
+static inline void handleApiSynthStats() {
+  beca::SynthStats s;
+  gSynth.getStats(s);
+  const float dl = s.deadlineUs > 0.0f ? s.deadlineUs : 1.0f;
+
+  char buf[1024];
+  int n = snprintf(
+    buf, sizeof(buf),
+    "{\"running\":%u,\"path\":\"%s\",\"blocks\":%lu,\"overruns\":%lu,\"deadline_us\":%.1f,"
+    "\"load_avg\":%.1f,\"load_max\":%.1f,"
+    "\"render\":{\"min\":%.1f,\"avg\":%.1f,\"max\":%.1f},\"stages\":{",
+    gSynth.running() ? 1u : 0u, gSynth.fixedPoint() ? "fixed" : "float",
+    (unsigned long)s.blocks, (unsigned long)s.overruns, (double)s.deadlineUs,
+    (double)(100.0f * s.render.avgUs / dl), (double)(100.0f * s.render.maxUs / dl),
+    (double)s.render.minUs, (double)s.render.avgUs, (double)s.render.maxUs
+  );
+  for (uint8_t st = 0; st < beca::SYNTH_STAGE_COUNT && n < (int)sizeof(buf); ++st) {
+    n += snprintf(buf + n, sizeof(buf) - n, "%s\"%s\":{\"min\":%.1f,\"avg\":%.1f,\"max\":%.1f}",
+                  st ? "," : "", beca::SynthEngine::stageName(st),
+                  (double)s.stage[st].minUs, (double)s.stage[st].avgUs, (double)s.stage[st].maxUs);
+  }
+  if (n < (int)sizeof(buf)) n += snprintf(buf + n, sizeof(buf) - n, "},\"hist_step_pct\":10,\"hist\":[");
+  for (uint8_t b = 0; b < beca::SynthStats::kHistBins && n < (int)sizeof(buf); ++b) {
+    n += snprintf(buf + n, sizeof(buf) - n, "%s%lu", b ? "," : "", (unsigned long)s.loadHist[b]);
+  }
+  if (n < (int)sizeof(buf)) {
+    snprintf(buf + n, sizeof(buf) - n,
+             "],\"governor\":{\"enabled\":%u,\"voice_cap\":%u,\"fx_lite\":%u,\"shed\":%lu,"
+             "\"fx_steps\":%lu,\"cap_steps\":%lu,\"restores\":%lu,\"drum_cap\":%u,\"drum_cuts\":%lu},"
+             "\"events\":{\"peak\":%u,\"dropped\":%lu,\"parked_offs\":%lu}}",
+             gSynth.loadGovernor() ? 1u : 0u, (unsigned)s.voiceCap, (unsigned)s.fxLite,
+             (unsigned long)s.voicesShed, (unsigned long)s.fxLiteSteps, (unsigned long)s.capSteps,
+             (unsigned long)s.restoreSteps, (unsigned)s.drumCap, (unsigned long)s.drumCuts,
+             (unsigned)s.eventPeak, (unsigned long)s.eventsDropped, (unsigned long)s.offsParked);
+  }
+
+  if (server.hasArg("governor")) gSynth.setLoadGovernor(server.arg("governor").toInt() != 0);
+  if (server.hasArg("reset") && server.arg("reset").toInt() != 0) gSynth.resetStats();
+  sendNoCacheHeaders();
+  server.send(200, "application/json", buf);
+}
+
+// I2S latency profiles. GET lists each profile with its trigger-to-sound
+// latency and the underruns it has had since boot, plus control-pass timing.
+// POST ?profile=<name|0-2> and/or ?realtime=0|1 switch, restarting the audio
+// task when it is running; ?parallel=0|1 switches second-core voice rendering
+// without a restart. ?reset=1 clears the control-pass maxima.
+static inline void handleApiSynthLatency() {
+  if (server.method() == HTTP_POST) {
+    int next = -1;
+    const String arg = server.arg("profile");
+    for (uint8_t l = 0; l < beca::SYNTH_LATENCY_COUNT; ++l) {
+      if (arg == beca::SynthEngine::latencyProfile(l).name) next = l;
+    }
+    if (next < 0 && arg.length() && isDigit(arg[0])) next = arg.toInt();
+    if (next < 0 && !arg.length()) next = gSynthLatency;
+    if (next < 0 || next >= (int)beca::SYNTH_LATENCY_COUNT) {
+      server.send(400, "application/json", "{\"ok\":0,\"err\":\"profile must be ultra_low, normal or safe\"}");
+      return;
+    }
+    const bool realtime = server.hasArg("realtime") ? server.arg("realtime").toInt() != 0 : gRealtimeAudio;
+    const bool parallel = server.hasArg("parallel") ? server.arg("parallel").toInt() != 0 : gParallelVoices;
+    if (parallel != gParallelVoices || realtime != gRealtimeAudio) {
+      // The worker takes its priority from the real-time setting when it starts.
+      gParallelVoices = parallel;
+      gSynth.setParallel(false);
+      gSynth.setRealtime(realtime);
+      gSynth.setParallel(gParallelVoices);
+      prefs.begin("beca", false);
+      prefs.putUChar("parallel", gParallelVoices ? 1 : 0);
+      prefs.end();
+    }
+    if ((uint8_t)next != gSynthLatency || realtime != gRealtimeAudio) {
+      gSynthLatency = (uint8_t)next;
+      // Takes effect from the next control pass: the lock hands it to the other core.
+      gRealtimeAudio = realtime;
+      prefs.begin("beca", false);
+      prefs.putUChar("latency", gSynthLatency);
+      prefs.putUChar("realtime", gRealtimeAudio ? 1 : 0);
+      prefs.end();
+      if (gSynth.running()) {
+        stopAuxAudio();
+        startAuxAudio();
+      }
+    }
+  }
+
+  beca::SynthStats s;
+  gSynth.getStats(s);
+  char buf[1024];
+  int n = snprintf(buf, sizeof(buf),
+                   "{\"profile\":\"%s\",\"running\":%u,\"latency_ms\":%.2f,"
+                   "\"realtime\":%u,\"control\":{\"core\":%d,\"pass_max_us\":%lu,\"web_max_us\":%lu,"
+                   "\"budget_us\":%lu,\"deferred\":%lu},"
+                   "\"parallel\":{\"on\":%u,\"slices\":%lu,\"reclaimed\":%lu},\"profiles\":[",
+                   beca::SynthEngine::latencyProfile(gSynthLatency).name, gSynth.running() ? 1u : 0u,
+                   (double)beca::SynthEngine::latencyMs(gSynthLatency, gSynth.sampleRate()),
+                   gRealtimeAudio ? 1u : 0u, xPortGetCoreID(), (unsigned long)gControlPassMaxUs,
+                   (unsigned long)gControlWebMaxUs, (unsigned long)CONTROL_PASS_BUDGET_US,
+                   (unsigned long)gControlDeferred, gSynth.parallel() ? 1u : 0u, (unsigned long)s.parallelSlices,
+                   (unsigned long)s.parallelReclaims);
+  for (uint8_t l = 0; l < beca::SYNTH_LATENCY_COUNT && n < (int)sizeof(buf); ++l) {
+    const beca::SynthLatencyProfile& lp = beca::SynthEngine::latencyProfile(l);
+    const float minutes = (float)s.profileBlocks[l] * lp.blockSize / ((float)gSynth.sampleRate() * 60.0f);
+    n += snprintf(buf + n, sizeof(buf) - n,
+                  "%s{\"name\":\"%s\",\"block\":%u,\"buffers\":%u,\"latency_ms\":%.2f,"
+                  "\"blocks\":%lu,\"underruns\":%lu,\"underruns_per_min\":%.2f}",
+                  l ? "," : "", lp.name, (unsigned)lp.blockSize, (unsigned)lp.bufferCount,
+                  (double)beca::SynthEngine::latencyMs(l, gSynth.sampleRate()), (unsigned long)s.profileBlocks[l],
+                  (unsigned long)s.profileUnderruns[l],
+                  (double)(minutes > 0.0f ? s.profileUnderruns[l] / minutes : 0.0f));
+  }
+  if (n < (int)sizeof(buf)) snprintf(buf + n, sizeof(buf) - n, "]}");
+  if (server.hasArg("reset") && server.arg("reset").toInt() != 0) {
+    gControlPassMaxUs = 0;
+    gControlWebMaxUs = 0;
+    gControlDeferred = 0;
+  }
+  sendNoCacheHeaders();
+  server.send(200, "application/json", buf);
+}
+
+static int hexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Up to maxLen bytes; len receives the count.
+static bool decodeHex(const String& hex, uint8_t* out, size_t maxLen, size_t& len) {
+  len = hex.length() / 2;
+  if ((hex.length() & 1) || len > maxLen) return false;
+  for (size_t i = 0; i < len; ++i) {
+    const int hi = hexNibble(hex[2 * i]);
+    const int lo = hexNibble(hex[2 * i + 1]);
+    if (hi < 0 || lo < 0) return false;
+    out[i] = (uint8_t)((hi << 4) | lo);
+  }
+  return true;
+}
+
+// Drum kits (see beca::DrumKitDef; blob layout in drum_engine.h). GET lists
+// them with the size of the sample bank, and ?dump=N adds kit N as a hex
+// blob to edit and send back. POST
+// slot=0-3&blob=<hex> stores a user kit and keeps it in NVS; &select=1 also
+// switches to it. The drumkit field of /api/synth selects any kit.
+static inline void handleApiDrumKit() {
+  if (server.method() == HTTP_POST) {
+    const int slot = server.hasArg("slot") ? server.arg("slot").toInt() : -1;
+    if (slot < 0 || slot >= (int)beca::DrumEngine::kUserKitCount) {
+      server.send(400, "application/json", "{\"ok\":0,\"err\":\"slot must be 0-3\"}");
+      return;
+    }
+    String hex = server.arg("blob");
+    hex.trim();
+    uint8_t blob[beca::DrumEngine::kKitBlobBytes];
+    beca::DrumKitDef kit;
+    size_t len = 0;
+    if (!decodeHex(hex, blob, sizeof(blob), len) || !beca::DrumEngine::parseKitBlob(blob, len, kit)) {
+      server.send(400, "application/json", "{\"ok\":0,\"err\":\"bad kit blob\"}");
+      return;
+    }
+    gSynth.storeDrumKit((uint8_t)slot, kit);
+    saveUserDrumKit((uint8_t)slot);
+    if (server.hasArg("select") && server.arg("select").toInt() != 0) {
+      gSynth.setParam(beca::SYNTH_PARAM_DRUM_KIT, (float)(beca::DrumEngine::kFactoryKitCount + slot));
+    }
+  }
+
+  const uint8_t current = (uint8_t)gSynth.param(beca::SYNTH_PARAM_DRUM_KIT);
+  const uint8_t userMask = gSynth.userDrumKitMask();
+  char buf[1536];
+  int n = snprintf(buf, sizeof(buf), "{\"kit\":%u,\"name\":\"%s\",\"user_kits\":%u,\"samples\":%u,\"kits\":[",
+                   (unsigned)current, beca::DrumEngine::kitName(current), (unsigned)userMask,
+                   (unsigned)gSynth.drumSamples().count());
+  for (uint8_t k = 0; k < beca::DrumEngine::kKitCount && n < (int)sizeof(buf); ++k) {
+    const bool user = k >= beca::DrumEngine::kFactoryKitCount;
+    const bool stored = !user || (userMask & (1u << (k - beca::DrumEngine::kFactoryKitCount)));
+    n += snprintf(buf + n, sizeof(buf) - n, "%s{\"index\":%u,\"name\":\"%s\",\"user\":%u,\"stored\":%u}",
+                  k ? "," : "", (unsigned)k, beca::DrumEngine::kitName(k), user ? 1u : 0u, stored ? 1u : 0u);
+  }
+  if (n < (int)sizeof(buf)) n += snprintf(buf + n, sizeof(buf) - n, "]");
+  const uint8_t dumpKit = (uint8_t)constrain(server.arg("dump").toInt(), 0, 255);
+  beca::DrumKitDef dump;
+  if (server.hasArg("dump") && gSynth.drumKit(dumpKit, dump) &&
+      n + 2 * (int)beca::DrumEngine::kKitBlobBytes + 32 < (int)sizeof(buf)) {
+    uint8_t blob[beca::DrumEngine::kKitBlobBytes];
+    beca::DrumEngine::writeKitBlob(dump, blob);
+    n += snprintf(buf + n, sizeof(buf) - n, ",\"dump\":%u,\"blob\":\"", (unsigned)dumpKit);
+    for (size_t i = 0; i < sizeof(blob); ++i) n += snprintf(buf + n, sizeof(buf) - n, "%02x", blob[i]);
+    n += snprintf(buf + n, sizeof(buf) - n, "\"");
+  }
+  if (n < (int)sizeof(buf)) snprintf(buf + n, sizeof(buf) - n, "}");
+  sendNoCacheHeaders();
+  server.send(200, "application/json", buf);
+}
+
 static inline void handleApiSynthTest() {
   if (ioMuteActive()) {
     server.send(423, "application/json", "{\"ok\":0,\"err\":\"I/O muted\"}");
@@ -1810,7 +2097,7 @@ static inline void setDrumSel() {
 }
 
 static inline void randomize() {
-  gMode  = (Mode)random(0, drumsAllowedForCurrentOutput() ? 4 : 3);
+  gMode  = (Mode)random(0, 4);
   gScale = (ScaleType)random(0, 15);
   fxMode = (EffectMode)random(0, (int)FX_COUNT);
   currentPaletteIndex = (uint8_t)random(0, NUM_BUILTIN + NUM_CUSTOM);
@@ -2242,6 +2529,7 @@ const uint32_t LED_INTERVAL_MS   = 34;   // ~29 FPS
 const uint32_t SSE_SCOPE_MS      = 100;  // 10 fps scope (plant only)
 const uint32_t SSE_NOTE_MS       = 60;   // ~16 fps note grid
 const uint32_t SSE_DRUM_MS       = 50;   // ~20 fps drum UI
+const uint32_t SSE_STATS_MS      = 1000; // synth CPU meter
 bool     gWarmupDone = false;
 uint32_t gWarmupEndMs = 0;
 
@@ -2293,7 +2581,14 @@ void setup() {
                   outputModeName(bootOutput), (unsigned long)AUX_STARTUP_LOCK_MS);
   }
   gOutputMode = bootOutput;
+  gSynthLatency = (uint8_t)constrain((int)prefs.getUChar("latency", beca::SYNTH_LATENCY_NORMAL), 0,
+                                     (int)beca::SYNTH_LATENCY_COUNT - 1);
+  gRealtimeAudio = prefs.getUChar("realtime", 0) != 0;
+  gParallelVoices = prefs.getUChar("parallel", 0) != 0;
   prefs.end();
+  restoreUserPresets();
+  restoreUserDrumKits();
+  gSynth.openDrumSamples("drums");  // optional; sampled kit parts synthesize without it
   if (gDeviceName.length() == 0) gDeviceName = "beca-" + shortChipId();
 
   bool staOK = false;
@@ -2352,6 +2647,11 @@ void setup() {
   server.on("/api/synth",      HTTP_GET,  handleApiSynthGet);
   server.on("/api/synth",      HTTP_POST, handleApiSynthPost);
   server.on("/api/synth/test", HTTP_GET,  handleApiSynthTest);
+  server.on("/api/synth/stats", HTTP_GET, handleApiSynthStats);
+  server.on("/api/synth/latency", HTTP_GET, handleApiSynthLatency);
+  server.on("/api/synth/latency", HTTP_POST, handleApiSynthLatency);
+  server.on("/api/drumkit",     HTTP_GET,  handleApiDrumKit);
+  server.on("/api/drumkit",     HTTP_POST, handleApiDrumKit);
 
   // NEW
   server.on("/drumsel", setDrumSel);
@@ -2403,21 +2703,35 @@ void setup() {
 
   recalcTransport(true);
   pushStateIfChanged(true);
+
+  gControlLock = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(controlTask, "beca_control", 8192, nullptr, 1, nullptr, 0);
+  gSynth.setRealtime(gRealtimeAudio);
+  gSynth.setParallel(gParallelVoices);
+  if (gRealtimeAudio) Serial.println("@I REALTIME AUDIO: control on core 0");
 }
 
 // -------------------- loop() --------------------
-void loop() {
+// Everything but audio rendering: web server, Wi-Fi upkeep, sensors,
+// transport, LEDs, SSE and MIDI input. Normally loop() runs it on core 1
+// beside the audio task. In real-time mode controlTask() runs it on core 0
+// next to the Wi-Fi stack, so core 1 is left to audio, and LED and SSE work
+// wait a pass once the pass has used CONTROL_PASS_BUDGET_US. Sensors,
+// transport and MIDI are never deferred.
+static void controlPass() {
   uint32_t now = millis();
+  const uint32_t passStartUs = micros();
 
   if (setupPortalActive()) dns.processNextRequest();
   server.handleClient();
+  const uint32_t webUs = micros() - passStartUs;
+  if (webUs > gControlWebMaxUs) gControlWebMaxUs = webUs;
   maintainWiFi(now);
   applyEncoder();
 
   // keep WDT + WiFi/BLE happy
   delay(0);
   warmupPlantBackground();
-  gSynth.service(now);
 
   // Plant sampling
   static uint32_t lastPlantMs = 0;
@@ -2436,8 +2750,11 @@ void loop() {
       T.swingOdd = !T.swingOdd;
       if (swingPct && T.swingOdd) swingAdd = (base * swingPct) / 100;
 
+      gStepStampMs = T.nextTickMs;
+      gStepStampValid = true;
       T.nextTickMs += base + swingAdd;
       transportTick();
+      gStepStampValid = false;
 
       if (--maxCatch == 0) break;
     } while ((int32_t)(now - T.nextTickMs) >= 0);
@@ -2447,9 +2764,13 @@ void loop() {
     }
   }
 
+  // Past its budget, a real-time pass leaves LEDs and SSE for the next one.
+  const bool overBudget = gRealtimeAudio && micros() - passStartUs >= CONTROL_PASS_BUDGET_US;
+  if (overBudget) ++gControlDeferred;
+
   // LED update
   static uint32_t lastLedMs = 0;
-  if ((int32_t)(now - lastLedMs) >= (int32_t)LED_INTERVAL_MS) {
+  if (!overBudget && (int32_t)(now - lastLedMs) >= (int32_t)LED_INTERVAL_MS) {
     lastLedMs = now;
     renderLEDs();
   }
@@ -2471,11 +2792,24 @@ void loop() {
     if (u > 0) {
       Serial.printf("@W I2S UNDERRUN %lu\n", (unsigned long)u);
     }
+
+    // Report load governor steps taken since the last check.
+    static uint32_t lastGovSteps = 0;
+    beca::SynthStats s;
+    gSynth.getStats(s);
+    const uint32_t govSteps = s.voicesShed + s.fxLiteSteps + s.capSteps + s.restoreSteps;
+    if (govSteps < lastGovSteps) lastGovSteps = 0;  // counters were reset
+    if (govSteps != lastGovSteps) {
+      lastGovSteps = govSteps;
+      Serial.printf("@W SYNTH LOAD shed=%lu fx_lite=%u cap=%u load_max=%.0f%%\n", (unsigned long)s.voicesShed,
+                    (unsigned)s.fxLite, (unsigned)s.voiceCap,
+                    (double)(s.deadlineUs > 0.0f ? 100.0f * s.render.maxUs / s.deadlineUs : 0.0f));
+    }
   }
 
 
   // SSE maintenance
-  if (sseConnected) {
+  if (sseConnected && !overBudget) {
     if (!sseClient.connected()) {
       sseConnected = false;
     } else if ((millis() - sseConnectedAt) > SSE_MAX_LIFETIME_MS) {
@@ -2527,8 +2861,7 @@ void loop() {
       }
 
       // Drum UI stream (diff-based): hitMask|selMask
-      if (drumsAllowedForCurrentOutput() &&
-          (int32_t)(now - lastSseDrumMs) >= (int32_t)SSE_DRUM_MS) {
+      if ((int32_t)(now - lastSseDrumMs) >= (int32_t)SSE_DRUM_MS) {
         lastSseDrumMs = now;
         uint8_t hit = drumHitMaskNow();
         uint8_t sel = (uint8_t)drumSelMask;
@@ -2542,6 +2875,24 @@ void loop() {
         }
       }
 
+      // Synth CPU meter: load in % of the block deadline, per-stage averages in us
+      if (gSynth.running() && (int32_t)(now - lastSseStatsMs) >= (int32_t)SSE_STATS_MS) {
+        lastSseStatsMs = now;
+        beca::SynthStats s;
+        gSynth.getStats(s);
+        const float dl = s.deadlineUs > 0.0f ? s.deadlineUs : 1.0f;
+        char buf[192];
+        int n = snprintf(buf, sizeof(buf),
+                         "{\"load_avg\":%.1f,\"load_max\":%.1f,\"overruns\":%lu,\"cap\":%u,\"fx_lite\":%u,\"stages\":[",
+                         (double)(100.0f * s.render.avgUs / dl), (double)(100.0f * s.render.maxUs / dl),
+                         (unsigned long)s.overruns, (unsigned)s.voiceCap, (unsigned)s.fxLite);
+        for (uint8_t st = 0; st < beca::SYNTH_STAGE_COUNT && n < (int)sizeof(buf); ++st) {
+          n += snprintf(buf + n, sizeof(buf) - n, "%s%.0f", st ? "," : "", (double)s.stage[st].avgUs);
+        }
+        if (n < (int)sizeof(buf)) snprintf(buf + n, sizeof(buf) - n, "]}");
+        sseSend("synth_stats", buf);
+      }
+
       // Keepalive
       if ((int32_t)(now - lastSseKeepAliveMs) >= 2000) {
         lastSseKeepAliveMs = now;
@@ -2552,6 +2903,30 @@ void loop() {
 
   serviceNoteOffs();
   if (!ioMuteActive()) MIDI.read();
+
+  const uint32_t passUs = micros() - passStartUs;
+  if (passUs > gControlPassMaxUs) gControlPassMaxUs = passUs;
+}
+
+// Runs a pass when the current mode puts it on this core. The lock keeps the
+// two callers from overlapping while a mode switch hands the loop over.
+static bool runControlPass(bool realtimeCaller) {
+  xSemaphoreTake(gControlLock, portMAX_DELAY);
+  const bool mine = gRealtimeAudio == realtimeCaller;
+  if (mine) controlPass();
+  xSemaphoreGive(gControlLock);
+  return mine;
+}
+
+static void controlTask(void*) {
+  for (;;) {
+    // Blocking every pass lets core 0's idle task feed the task watchdog.
+    vTaskDelay(runControlPass(true) ? 1 : pdMS_TO_TICKS(20));
+  }
+}
+
+void loop() {
+  if (!runControlPass(false)) delay(20);
 }
 
 
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Thin platform layer under the audio engines: I2S output, the audio task,
+// mapped sample data and the short critical sections guarding engine state.
+// The ESP32 side lives in audio_platform_esp32.cpp; host tools link
+// tools/host_render/platform_host.cpp.
+
+#if defined(ARDUINO_ARCH_ESP32) || defined(ESP_PLATFORM)
+#define BECA_PLATFORM_ESP32 1
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <esp_task.h>
+#else
+#define BECA_PLATFORM_ESP32 0
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace beca {
+namespace platform {
+
+// Spinlock-style critical section; hold it only for a few loads and stores.
+class CriticalSection {
+ public:
+#if BECA_PLATFORM_ESP32
+  CriticalSection() : mux_(portMUX_INITIALIZER_UNLOCKED) {}
+  void enter() { portENTER_CRITICAL(&mux_); }
+  void exit() { portEXIT_CRITICAL(&mux_); }
+
+ private:
+  portMUX_TYPE mux_;
+#else
+  CriticalSection() { flag_.clear(); }
+  void enter() {
+    while (flag_.test_and_set(std::memory_order_acquire)) {
+    }
+  }
+  void exit() { flag_.clear(std::memory_order_release); }
+
+ private:
+  std::atomic_flag flag_;
+#endif
+};
+
+// Binary semaphore: post() wakes one wait(), and posts do not accumulate.
+class Signal {
+ public:
+#if BECA_PLATFORM_ESP32
+  Signal() : sem_(xSemaphoreCreateBinaryStatic(&buf_)) {}
+  void post() { xSemaphoreGive(sem_); }
+  // False when nothing was posted within timeoutMs.
+  bool wait(uint32_t timeoutMs) { return xSemaphoreTake(sem_, pdMS_TO_TICKS(timeoutMs)) == pdTRUE; }
+
+ private:
+  StaticSemaphore_t buf_;
+  SemaphoreHandle_t sem_;
+#else
+  Signal() : posted_(false) {}
+  void post() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      posted_ = true;
+    }
+    cond_.notify_one();
+  }
+  bool wait(uint32_t timeoutMs) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!cond_.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return posted_; })) return false;
+    posted_ = false;
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  bool posted_;
+#endif
+};
+
+struct AudioOutConfig {
+  int pinBck;
+  int pinWs;
+  int pinData;
+  uint32_t sampleRate;
+  uint16_t framesPerBuffer;
+  uint8_t bufferCount;
+};
+
+// Interleaved 16-bit stereo output (I2S on the device).
+class AudioOut {
+ public:
+  AudioOut();
+  bool begin(const AudioOutConfig& cfg);
+  // Blocks up to timeoutMs for DMA space; false if the whole block was not queued.
+  bool write(const int16_t* frames, uint16_t frameCount, uint32_t timeoutMs);
+  void end();
+  bool open() const { return open_; }
+
+ private:
+  bool open_;
+  int port_;
+};
+
+// Free-running cycle counter for stage timing; differences wrap correctly.
+#if BECA_PLATFORM_ESP32
+inline uint32_t cycleCount() { return ESP.getCycleCount(); }
+inline uint32_t cyclesPerUs() { return getCpuFrequencyMhz(); }
+#else
+uint32_t cycleCount();
+uint32_t cyclesPerUs();
+#endif
+
+// Large buffers that may live in external PSRAM; nullptr when there is none.
+void* allocExternal(size_t bytes);
+void freeExternal(void* ptr);
+
+// Read-only data mapped into the address space, not copied: a flash data
+// partition found by its label on the device, a file on the host.
+class MappedData {
+ public:
+  MappedData();
+  ~MappedData() { unmap(); }
+  MappedData(const MappedData&) = delete;
+  MappedData& operator=(const MappedData&) = delete;
+  bool map(const char* name);
+  void unmap();
+  const uint8_t* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+  uint32_t handle_;
+};
+
+typedef void (*TaskEntry)(void* arg);
+
+// Priority for a real-time audio task: above lwIP's task, which is not pinned
+// and can run on the audio core, and below the Wi-Fi driver.
+#if BECA_PLATFORM_ESP32
+static constexpr uint8_t kRealtimePriority = ESP_TASK_TCPIP_PRIO + 1;
+#else
+static constexpr uint8_t kRealtimePriority = 2;
+#endif
+
+// Starts a task pinned to a core where supported. The entry function must call
+// endCurrentTask() instead of returning.
+bool startTask(TaskEntry entry, const char* name, uint32_t stackBytes, void* arg, uint8_t priority, int8_t core);
+void endCurrentTask();
+void yieldTask();
+
+}  // namespace platform
+}  // namespace beca
@@ -0,0 +1,116 @@
+#include "audio_platform.h"
+
+#if BECA_PLATFORM_ESP32
+
+#include <driver/i2s.h>
+#include <esp_heap_caps.h>
+#include <esp_partition.h>
+
+namespace beca {
+namespace platform {
+
+AudioOut::AudioOut() : open_(false), port_(I2S_NUM_0) {}
+
+bool AudioOut::begin(const AudioOutConfig& c) {
+  if (open_) return true;
+  const i2s_port_t port = static_cast<i2s_port_t>(port_);
+
+  i2s_config_t cfg = {};
+  cfg.mode = static_cast<i2s_mode_t>(I2S_MODE_MASTER | I2S_MODE_TX);
+  cfg.sample_rate = static_cast<int>(c.sampleRate);
+  cfg.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+  cfg.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
+  cfg.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+  cfg.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
+  cfg.dma_buf_count = c.bufferCount;
+  cfg.dma_buf_len = c.framesPerBuffer;
+  cfg.use_apll = false;
+  cfg.tx_desc_auto_clear = true;
+  cfg.fixed_mclk = 0;
+
+  i2s_pin_config_t pinCfg = {};
+  pinCfg.bck_io_num = c.pinBck;
+  pinCfg.ws_io_num = c.pinWs;
+  pinCfg.data_out_num = c.pinData;
+  pinCfg.data_in_num = I2S_PIN_NO_CHANGE;
+
+  if (i2s_driver_install(port, &cfg, 0, nullptr) != ESP_OK) return false;
+  if (i2s_set_pin(port, &pinCfg) != ESP_OK) {
+    i2s_driver_uninstall(port);
+    return false;
+  }
+  i2s_zero_dma_buffer(port);
+  open_ = true;
+  return true;
+}
+
+bool AudioOut::write(const int16_t* frames, uint16_t frameCount, uint32_t timeoutMs) {
+  const size_t bytes = static_cast<size_t>(frameCount) * 2u * sizeof(int16_t);
+  size_t bytesWritten = 0;
+  const esp_err_t err = i2s_write(static_cast<i2s_port_t>(port_), frames, bytes, &bytesWritten,
+                                  timeoutMs / portTICK_PERIOD_MS);
+  return err == ESP_OK && bytesWritten == bytes;
+}
+
+void AudioOut::end() {
+  if (!open_) return;
+  const i2s_port_t port = static_cast<i2s_port_t>(port_);
+  i2s_zero_dma_buffer(port);
+  i2s_stop(port);
+  i2s_driver_uninstall(port);
+  open_ = false;
+}
+
+void* allocExternal(size_t bytes) {
+  if (!psramFound()) return nullptr;
+  return heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+
+void freeExternal(void* ptr) {
+  heap_caps_free(ptr);
+}
+
+MappedData::MappedData() : data_(nullptr), size_(0), handle_(0) {}
+
+// Any data partition with this label; the flash cache maps it read-only, so
+// reads cost cache misses but no RAM.
+bool MappedData::map(const char* name) {
+  unmap();
+  const esp_partition_t* part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+  if (!part) return false;
+  const void* ptr = nullptr;
+  spi_flash_mmap_handle_t handle = 0;
+  if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &ptr, &handle) != ESP_OK) return false;
+  data_ = static_cast<const uint8_t*>(ptr);
+  size_ = part->size;
+  handle_ = handle;
+  return true;
+}
+
+void MappedData::unmap() {
+  if (!data_) return;
+  spi_flash_munmap(handle_);
+  data_ = nullptr;
+  size_ = 0;
+  handle_ = 0;
+}
+
+bool startTask(TaskEntry entry, const char* name, uint32_t stackBytes, void* arg, uint8_t priority, int8_t core) {
+  TaskHandle_t handle = nullptr;
+  const BaseType_t ok = core < 0 ? xTaskCreate(entry, name, stackBytes, arg, priority, &handle)
+                                 : xTaskCreatePinnedToCore(entry, name, stackBytes, arg, priority, &handle, core);
+  return ok == pdPASS;
+}
+
+void endCurrentTask() {
+  vTaskDelete(nullptr);
+}
+
+void yieldTask() {
+  taskYIELD();
+}
+
+}  // namespace platform
+}  // namespace beca
+
+#endif  // BECA_PLATFORM_ESP32
@@ -1,203 +1,489 @@
 #include "drum_engine.h"
 
 #include <math.h>
+#include <string.h>
 
 namespace beca {
 
-DrumEngine::DrumEngine() : sampleRate_(44100.0f), kit_(0) {
+constexpr uint16_t DrumEngine::kMaxBlock;
+constexpr uint16_t DrumEngine::kKitBlobBytes;
+
+namespace {
+
+// Studio kit; the factory kits scale its times and tuning. Fields follow
+// DrumPartDef: freq, pitch sweep/decay, attack, decay time and level, tone,
+// noise, pan, drive, gain, flags, chokes, sample.
+constexpr DrumPartDef kBaseParts[kDrumPartCount] = {
+    // Kick
+    {52.0f, 2.0f, 0.90f, 0.0014f, 0.50f, 0.0008f, 1.0f, 0.04f, 0.5f, 0.12f, 0.52f, 0, 0, kDrumNoSample},
+    // Snare
+    {196.0f, 0.45f, 0.93f, 0.0012f, 0.29f, 0.0010f, 0.42f, 0.70f, 0.52f, 0.08f, 0.30f, 0, 0, kDrumNoSample},
+    // Closed HH, chokes the open hat
+    {430.0f, 0.0f, 0.98f, 0.0009f, 0.075f, 0.0009f, 0.03f, 0.98f, 0.42f, 0.03f, 0.12f,
+     DRUM_PART_LOW_CUT, 1u << 3, kDrumNoSample},
+    // Open HH
+    {520.0f, 0.0f, 0.98f, 0.0012f, 0.34f, 0.0009f, 0.05f, 0.95f, 0.58f, 0.03f, 0.14f,
+     DRUM_PART_LOW_CUT, 0, kDrumNoSample},
+    // Tom 1
+    {148.0f, 0.85f, 0.915f, 0.0015f, 0.34f, 0.0010f, 0.92f, 0.05f, 0.38f, 0.06f, 0.24f,
+     DRUM_PART_LOW_CUT, 0, kDrumNoSample},
+    // Tom 2
+    {108.0f, 0.95f, 0.915f, 0.0015f, 0.42f, 0.0010f, 0.92f, 0.05f, 0.64f, 0.06f, 0.24f,
+     DRUM_PART_LOW_CUT, 0, kDrumNoSample},
+    // Ride
+    {640.0f, 0.0f, 0.98f, 0.0011f, 0.70f, 0.0009f, 0.24f, 0.78f, 0.72f, 0.03f, 0.14f,
+     DRUM_PART_LOW_CUT, 0, kDrumNoSample},
+    // Crash
+    {520.0f, 0.0f, 0.98f, 0.0010f, 0.92f, 0.00085f, 0.10f, 0.92f, 0.66f, 0.05f, 0.16f,
+     DRUM_PART_LOW_CUT, 0, kDrumNoSample},
+};
+
+// Kick, snare and toms follow the kit tuning; hats and cymbals do not.
+constexpr uint8_t kTunedParts = (1u << 0) | (1u << 1) | (1u << 4) | (1u << 5);
+
+constexpr DrumPartDef scaledPart(uint8_t i, float decay, float tone, float noise, float attack, bool sampled) {
+  return DrumPartDef{(kTunedParts & (1u << i)) ? kBaseParts[i].freq * tone : kBaseParts[i].freq,
+                     kBaseParts[i].pitchSweep,
+                     kBaseParts[i].pitchDecay,
+                     kBaseParts[i].attackSec * attack,
+                     kBaseParts[i].decaySec * decay,
+                     kBaseParts[i].decayLevel,
+                     kBaseParts[i].toneMix,
+                     kBaseParts[i].noiseMix * noise,
+                     kBaseParts[i].pan,
+                     kBaseParts[i].drive,
+                     kBaseParts[i].gain,
+                     kBaseParts[i].flags,
+                     kBaseParts[i].chokes,
+                     sampled ? i : kBaseParts[i].sample};
+}
+
+constexpr DrumKitDef scaledKit(float master, float decay, float tone, float noise, float attack,
+                               bool sampled = false) {
+  return DrumKitDef{master,
+                    {scaledPart(0, decay, tone, noise, attack, sampled),
+                     scaledPart(1, decay, tone, noise, attack, sampled),
+                     scaledPart(2, decay, tone, noise, attack, sampled),
+                     scaledPart(3, decay, tone, noise, attack, sampled),
+                     scaledPart(4, decay, tone, noise, attack, sampled),
+                     scaledPart(5, decay, tone, noise, attack, sampled),
+                     scaledPart(6, decay, tone, noise, attack, sampled),
+                     scaledPart(7, decay, tone, noise, attack, sampled)}};
+}
+
+// Factory kits, in flash: master, decay/tone/noise/attack scale. The sampled
+// kit plays bank entries 0-7 on parts 0-7 and is the studio kit without a bank.
+constexpr DrumKitDef kFactoryKits[DrumEngine::kFactoryKitCount] = {
+    scaledKit(0.74f, 1.0f, 1.0f, 1.0f, 1.0f),
+    scaledKit(0.70f, 1.15f, 0.92f, 0.90f, 1.2f),
+    scaledKit(0.68f, 0.88f, 1.05f, 0.78f, 0.9f),
+    scaledKit(0.74f, 1.0f, 1.0f, 1.0f, 1.0f, true),
+};
+
+const char* const kKitNames[DrumEngine::kKitCount] = {
+    "Studio", "Room", "Tight", "Sampled", "User 1", "User 2", "User 3", "User 4",
+};
+
+static_assert(sizeof(kKitNames) / sizeof(kKitNames[0]) == DrumEngine::kKitCount, "one name per kit");
+
+// NaN lands on lo, infinities on the nearer bound.
+inline float clampDef(float v, float lo, float hi) { return v >= lo ? (v <= hi ? v : hi) : lo; }
+
+void clampPart(DrumPartDef& d, uint8_t part) {
+  d.freq = clampDef(d.freq, 20.0f, 8000.0f);
+  d.pitchSweep = clampDef(d.pitchSweep, 0.0f, 8.0f);
+  d.pitchDecay = clampDef(d.pitchDecay, 0.0f, 0.99999f);
+  d.attackSec = clampDef(d.attackSec, 0.0001f, 0.5f);
+  d.decaySec = clampDef(d.decaySec, 0.005f, 8.0f);
+  d.decayLevel = clampDef(d.decayLevel, 0.00001f, 0.5f);
+  d.toneMix = clampDef(d.toneMix, 0.0f, 2.0f);
+  d.noiseMix = clampDef(d.noiseMix, 0.0f, 2.0f);
+  d.pan = clampDef(d.pan, 0.0f, 1.0f);
+  d.drive = clampDef(d.drive, 0.0f, 1.0f);
+  d.gain = clampDef(d.gain, 0.0f, 1.0f);
+  d.flags &= DRUM_PART_LOW_CUT;
+  d.chokes &= static_cast<uint8_t>(~(1u << part));
+}
+
+float readF32(const uint8_t* p) {
+  const uint32_t bits = static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+                        (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+  float v;
+  memcpy(&v, &bits, sizeof(v));
+  return v;
+}
+
+uint8_t* writeF32(uint8_t* p, float v) {
+  uint32_t bits;
+  memcpy(&bits, &v, sizeof(bits));
+  p[0] = static_cast<uint8_t>(bits);
+  p[1] = static_cast<uint8_t>(bits >> 8);
+  p[2] = static_cast<uint8_t>(bits >> 16);
+  p[3] = static_cast<uint8_t>(bits >> 24);
+  return p + 4;
+}
+
+}  // namespace
+
+DrumEngine::DrumEngine()
+    : sampleRate_(44100.0f),
+      phaseScale_(4294967296.0f / 44100.0f),
+      cutDecay_(0.97f),
+      kit_(0),
+      maxParts_(kPartCount),
+      partFrames_(0),
+      userKitMask_(0) {
+  setKit(0);
   allOff();
 }
 
 void DrumEngine::init(float sampleRate) {
   sampleRate_ = sampleRate > 4000.0f ? sampleRate : 44100.0f;
+  phaseScale_ = 4294967296.0f / sampleRate_;
+  // A part cut for the part cap is down 60 dB after 5 ms: quick, but no click.
+  cutDecay_ = powf(0.001f, 1.0f / (sampleRate_ * 0.005f));
+  partFrames_ = 0;
+  noise_.reset();  // repeatable offline renders
+  setKit(kit_);
   allOff();
 }
 
 void DrumEngine::setKit(uint8_t kit) {
-  kit_ = kit > 2 ? 2 : kit;
+  kit_ = kit < kKitCount ? kit : kKitCount - 1;
+  DrumKitDef def;
+  if (!kitDef(kit_, def)) def = kFactoryKits[0];
+
+  for (uint8_t i = 0; i < kPartCount; ++i) {
+    const DrumPartDef& d = def.parts[i];
+    PartCoeffs& c = coeffs_[i];
+    const float gain = d.gain * def.master;
+    c.freq = d.freq;
+    c.pitchSweep = d.pitchSweep;
+    c.pitchDecay = d.pitchDecay;
+    c.attackInc = 1.0f / (sampleRate_ * d.attackSec);
+    c.decay = powf(d.decayLevel, 1.0f / (sampleRate_ * d.decaySec));
+    c.toneMix = d.toneMix;
+    c.noiseMix = d.noiseMix;
+    c.drive = 1.0f + d.drive * 3.2f;
+    c.gainL = gain * (1.0f - d.pan);
+    c.gainR = gain * d.pan;
+    c.flags = d.flags;
+    c.chokes = d.chokes;
+    DrumSampleBank::Sample smp;
+    if (d.sample != kDrumNoSample && samples_.sample(d.sample, smp)) {
+      c.pcm = smp.pcm;
+      c.frames = smp.frames;
+      c.step = static_cast<uint32_t>(static_cast<float>(smp.sampleRate) * 65536.0f / sampleRate_ + 0.5f);
+    } else {
+      c.pcm = nullptr;
+      c.frames = 0;
+      c.step = 0;
+    }
+  }
+}
+
+bool DrumEngine::openSamples(const char* name) {
+  allOff();
+  const bool ok = samples_.open(name);
+  setKit(kit_);
+  allOff();
+  return ok;
+}
+
+const char* DrumEngine::kitName(uint8_t kit) {
+  return kit < kKitCount ? kKitNames[kit] : "Unknown";
+}
+
+bool DrumEngine::storeKit(uint8_t slot, const DrumKitDef& kit) {
+  if (slot >= kUserKitCount) return false;
+  DrumKitDef def = kit;
+  def.master = clampDef(def.master, 0.0f, 1.0f);
+  for (uint8_t i = 0; i < kPartCount; ++i) clampPart(def.parts[i], i);
+  kitLock_.enter();
+  userKits_[slot] = def;
+  userKitMask_ |= 1u << slot;
+  kitLock_.exit();
+  return true;
+}
+
+bool DrumEngine::kitDef(uint8_t kit, DrumKitDef& out) const {
+  if (kit < kFactoryKitCount) {
+    out = kFactoryKits[kit];
+    return true;
+  }
+  const uint8_t slot = kit - kFactoryKitCount;
+  if (slot >= kUserKitCount) return false;
+  kitLock_.enter();
+  const bool stored = (userKitMask_ & (1u << slot)) != 0;
+  if (stored) out = userKits_[slot];
+  kitLock_.exit();
+  return stored;
+}
+
+bool DrumEngine::parseKitBlob(const uint8_t* data, size_t len, DrumKitDef& out) {
+  if (!data || len < 8 || memcmp(data, "BKIT", 4) != 0 || data[5] != kPartCount) return false;
+  const uint8_t version = data[4];
+  // Version 1 parts end at chokes.
+  const uint16_t partBytes = version == 1 ? kKitBlobPartBytes - 1 : kKitBlobPartBytes;
+  if ((version != 1 && version != kKitBlobVersion) || len != 8u + 4u + kPartCount * partBytes) return false;
+  const uint8_t* p = data + 8;
+  out.master = readF32(p);
+  p += 4;
+  for (uint8_t i = 0; i < kPartCount; ++i) {
+    DrumPartDef& d = out.parts[i];
+    float* const fields[11] = {&d.freq,     &d.pitchSweep, &d.pitchDecay, &d.attackSec, &d.decaySec, &d.decayLevel,
+                               &d.toneMix, &d.noiseMix,   &d.pan,        &d.drive,     &d.gain};
+    for (float* f : fields) {
+      *f = readF32(p);
+      p += 4;
+    }
+    d.flags = *p++;
+    d.chokes = *p++;
+    d.sample = version == 1 ? kDrumNoSample : *p++;
+  }
+  return true;
+}
+
+void DrumEngine::writeKitBlob(const DrumKitDef& kit, uint8_t* out) {
+  memcpy(out, "BKIT", 4);
+  out[4] = kKitBlobVersion;
+  out[5] = kPartCount;
+  out[6] = 0;
+  out[7] = 0;
+  uint8_t* p = writeF32(out + 8, kit.master);
+  for (uint8_t i = 0; i < kPartCount; ++i) {
+    const DrumPartDef& d = kit.parts[i];
+    const float fields[11] = {d.freq,    d.pitchSweep, d.pitchDecay, d.attackSec, d.decaySec, d.decayLevel,
+                              d.toneMix, d.noiseMix,   d.pan,        d.drive,     d.gain};
+    for (float f : fields) p = writeF32(p, f);
+    *p++ = d.flags;
+    *p++ = d.chokes;
+    *p++ = d.sample;
+  }
 }
 
 void DrumEngine::allOff() {
-  for (auto& v : voices_) {
+  for (uint8_t i = 0; i < kPartCount; ++i) {
+    Voice& v = voices_[i];
+    v.c = coeffs_[i];
     v.active = false;
+    v.decaying = false;
     v.env = 0.0f;
     v.envTarget = 0.0f;
-    v.attackInc = 1.0f;
-    v.decay = 0.99f;
-    v.phase = 0.0f;
-    v.freq = 120.0f;
+    v.phase = 0;
+    v.frac = 0;
     v.pitchEnv = 0.0f;
-    v.pitchDecay = 0.98f;
-    v.toneMix = 0.5f;
-    v.noiseMix = 0.5f;
-    v.pan = 0.5f;
-    v.drive = 0.0f;
     v.hpMem = 0.0f;
     v.lpMem = 0.0f;
     v.noiseHp = 0.0f;
   }
 }
 
-void DrumEngine::setupVoice(uint8_t part, float velNorm) {
-  if (part >= kPartCount) return;
+bool DrumEngine::trigger(uint8_t part, uint8_t velocity) {
+  if (part >= kPartCount) return false;
+  const float velNorm = dsp::clampf(static_cast<float>(velocity) / 127.0f, 0.0f, 1.0f);
   Voice& v = voices_[part];
-
-  const float kitDecayScale[3] = {1.0f, 1.15f, 0.88f};
-  const float kitToneScale[3] = {1.0f, 0.92f, 1.05f};
-  const float kitNoiseScale[3] = {1.0f, 0.90f, 0.78f};
-  const float kitAtkScale[3] = {1.0f, 1.2f, 0.9f};
-  const float ks = kitDecayScale[kit_];
-  const float ts = kitToneScale[kit_];
-  const float ns = kitNoiseScale[kit_];
-  const float as = kitAtkScale[kit_];
-
+  memcpy(&v.c, &coeffs_[part], sizeof(v.c));
   v.active = true;
+  v.decaying = false;
   v.env = 0.0f;
   v.envTarget = dsp::clampf(velNorm, 0.12f, 1.0f);
-  v.phase = 0.0f;
-  v.pitchEnv = 0.0f;
+  v.phase = 0;
+  v.frac = 0;
+  v.pitchEnv = v.c.pitchSweep;
   v.hpMem = 0.0f;
   v.lpMem = 0.0f;
   v.noiseHp = 0.0f;
-  v.attackInc = 1.0f / (sampleRate_ * 0.0018f * as);
-
-  switch (part) {
-    case 0:  // Kick
-      v.freq = 52.0f * ts;
-      v.pitchEnv = 2.0f;
-      v.pitchDecay = 0.90f;
-      v.attackInc = 1.0f / (sampleRate_ * 0.0014f * as);
-      v.decay = powf(0.0008f, 1.0f / (sampleRate_ * 0.50f * ks));
-      v.toneMix = 1.0f;
-      v.noiseMix = 0.04f * ns;
-      v.pan = 0.5f;
-      v.drive = 0.12f;
-      break;
-    case 1:  // Snare
-      v.freq = 196.0f * ts;
-      v.pitchEnv = 0.45f;
-      v.pitchDecay = 0.93f;
-      v.attackInc = 1.0f / (sampleRate_ * 0.0012f * as);
-      v.decay = powf(0.0010f, 1.0f / (sampleRate_ * 0.29f * ks));
-      v.toneMix = 0.42f;
-      v.noiseMix = 0.70f * ns;
-      v.pan = 0.52f;
-      v.drive = 0.08f;
-      break;
-    case 2:  // Closed HH
-      v.freq = 430.0f;
-      v.attackInc = 1.0f / (sampleRate_ * 0.0009f * as);
-      v.decay = powf(0.0009f, 1.0f / (sampleRate_ * 0.075f * ks));
-      v.toneMix = 0.03f;
-      v.noiseMix = 0.98f * ns;
-      v.pan = 0.42f;
-      v.drive = 0.03f;
-      // Closed hat chokes open hat.
-      voices_[3].env *= 0.05f;
-      break;
-    case 3:  // Open HH
-      v.freq = 520.0f;
-      v.attackInc = 1.0f / (sampleRate_ * 0.0012f * as);
-      v.decay = powf(0.0009f, 1.0f / (sampleRate_ * 0.34f * ks));
-      v.toneMix = 0.05f;
-      v.noiseMix = 0.95f * ns;
-      v.pan = 0.58f;
-      v.drive = 0.03f;
-      break;
-    case 4:  // Tom 1
-      v.freq = 148.0f * ts;
-      v.pitchEnv = 0.85f;
-      v.pitchDecay = 0.915f;
-      v.attackInc = 1.0f / (sampleRate_ * 0.0015f * as);
-      v.decay = powf(0.0010f, 1.0f / (sampleRate_ * 0.34f * ks));
-      v.toneMix = 0.92f;
-      v.noiseMix = 0.05f * ns;
-      v.pan = 0.38f;
-      v.drive = 0.06f;
-      break;
-    case 5:  // Tom 2
-      v.freq = 108.0f * ts;
-      v.pitchEnv = 0.95f;
-      v.pitchDecay = 0.915f;
-      v.attackInc = 1.0f / (sampleRate_ * 0.0015f * as);
-      v.decay = powf(0.0010f, 1.0f / (sampleRate_ * 0.42f * ks));
-      v.toneMix = 0.92f;
-      v.noiseMix = 0.05f * ns;
-      v.pan = 0.64f;
-      v.drive = 0.06f;
-      break;
-    case 6:  // Ride
-      v.freq = 640.0f;
-      v.attackInc = 1.0f / (sampleRate_ * 0.0011f * as);
-      v.decay = powf(0.0009f, 1.0f / (sampleRate_ * 0.70f * ks));
-      v.toneMix = 0.24f;
-      v.noiseMix = 0.78f * ns;
-      v.pan = 0.72f;
-      v.drive = 0.03f;
-      break;
-    case 7:  // Crash
-      v.freq = 520.0f;
-      v.attackInc = 1.0f / (sampleRate_ * 0.0010f * as);
-      v.decay = powf(0.00085f, 1.0f / (sampleRate_ * 0.92f * ks));
-      v.toneMix = 0.10f;
-      v.noiseMix = 0.92f * ns;
-      v.pan = 0.66f;
-      v.drive = 0.05f;
-      break;
+  for (uint8_t i = 0; i < kPartCount; ++i) {
+    if (v.c.chokes & (1u << i)) {
+      voices_[i].env *= 0.05f;
+      voices_[i].decaying = true;
+    }
   }
+
+  return cutOverCap(part) > 0;
 }
 
-void DrumEngine::trigger(uint8_t part, uint8_t velocity) {
-  const float velNorm = dsp::clampf(static_cast<float>(velocity) / 127.0f, 0.0f, 1.0f);
-  setupVoice(part, velNorm);
+uint8_t DrumEngine::setMaxParts(uint8_t n) {
+  maxParts_ = n < 1 ? 1 : (n > kPartCount ? kPartCount : n);
+  return cutOverCap(kPartCount);
+}
+
+// Fades the quietest parts, other than `keep`, until no more than maxParts_
+// are sounding without a cut fade. envTarget 0 marks a part already cut.
+uint8_t DrumEngine::cutOverCap(uint8_t keep) {
+  uint8_t sounding = 0;
+  for (uint8_t i = 0; i < kPartCount; ++i) {
+    if (voices_[i].active && voices_[i].envTarget != 0.0f) ++sounding;
+  }
+  uint8_t cuts = 0;
+  for (; sounding > maxParts_; --sounding) {
+    uint8_t quietest = kPartCount;
+    for (uint8_t i = 0; i < kPartCount; ++i) {
+      const Voice& o = voices_[i];
+      if (i == keep || !o.active || o.envTarget == 0.0f) continue;
+      if (quietest == kPartCount || o.env < voices_[quietest].env) quietest = i;
+    }
+    if (quietest == kPartCount) break;
+    voices_[quietest].envTarget = 0.0f;
+    voices_[quietest].decaying = true;
+    voices_[quietest].c.decay = cutDecay_;
+    ++cuts;
+  }
+  return cuts;
+}
+
+bool DrumEngine::active() const {
+  for (uint8_t i = 0; i < kPartCount; ++i) {
+    if (voices_[i].active) return true;
+  }
+  return false;
+}
+
+uint32_t DrumEngine::takePartFrames() {
+  const uint32_t frames = partFrames_;
+  partFrames_ = 0;
+  return frames;
+}
+
+void DrumEngine::renderBlock(float* outL, float* outR, uint16_t n) {
+  memset(outL, 0, sizeof(float) * n);
+  memset(outR, 0, sizeof(float) * n);
+  while (n > 0) {
+    const uint16_t chunk = n < kMaxBlock ? n : kMaxBlock;
+    renderChunk(outL, outR, chunk);
+    outL += chunk;
+    outR += chunk;
+    n -= chunk;
+  }
 }
 
-void DrumEngine::render(float& outL, float& outR) {
-  outL = 0.0f;
-  outR = 0.0f;
+// One part at a time over the whole chunk, its state held in locals.
+void DrumEngine::renderChunk(float* outL, float* outR, uint16_t n) {
+  if (!active()) return;
+  // The block is stored twice so each part can read it from its own rotation:
+  // at any one frame the parts hear different draws, so their noise sums
+  // like independent sources rather than one source at the summed level.
+  for (uint16_t j = 0; j < n; ++j) noiseBlock_[j] = noise_.next();
+  memcpy(noiseBlock_ + n, noiseBlock_, sizeof(float) * n);
 
-  const float partGain[8] = {0.52f, 0.30f, 0.12f, 0.14f, 0.24f, 0.24f, 0.14f, 0.16f};
-  const float kitMaster[3] = {0.74f, 0.70f, 0.68f};
+  const int16_t* sine = dsp::sineTable();
 
   for (uint8_t i = 0; i < kPartCount; ++i) {
     Voice& v = voices_[i];
     if (!v.active) continue;
-
-    if (v.env < v.envTarget) {
-      v.env += v.attackInc;
-      if (v.env > v.envTarget) v.env = v.envTarget;
-    } else {
-      v.env *= v.decay;
-    }
-    if (v.env < 0.00015f) {
-      v.active = false;
+    partFrames_ += n;
+    if (v.c.pcm) {
+      renderSampled(v, outL, outR, n);
       continue;
     }
 
-    v.pitchEnv *= v.pitchDecay;
-    const float freq = v.freq * (1.0f + v.pitchEnv);
-    v.phase += 2.0f * dsp::kPi * freq / sampleRate_;
-    if (v.phase >= 2.0f * dsp::kPi) v.phase -= 2.0f * dsp::kPi;
+    const PartCoeffs& c = v.c;
+    const bool lowCut = (c.flags & DRUM_PART_LOW_CUT) != 0;
+    const float* noiseIn = noiseBlock_ + (static_cast<uint32_t>(i) * n) / kPartCount;
+    // Parts without a pitch sweep keep one phase increment for the chunk.
+    const bool sweep = v.pitchEnv != 0.0f;
+    uint32_t phaseInc = static_cast<uint32_t>(c.freq * phaseScale_);
+
+    float env = v.env;
+    bool decaying = v.decaying;
+    float pitchEnv = v.pitchEnv;
+    uint32_t phase = v.phase;
+    float noiseHp = v.noiseHp;
+    float lpMem = v.lpMem;
+    float hpMem = v.hpMem;
+
+    for (uint16_t j = 0; j < n; ++j) {
+      if (decaying) {
+        env *= c.decay;
+      } else {
+        env += c.attackInc;
+        if (env >= v.envTarget) {
+          env = v.envTarget;
+          decaying = true;
+        }
+      }
+      if (decaying && env < 0.00015f) {
+        v.active = false;
+        break;
+      }
 
-    const float metallic = sinf(v.phase) + 0.34f * sinf(v.phase * 1.97f) + 0.18f * sinf(v.phase * 2.93f);
-    float noise = noise_.next();
-    v.noiseHp += 0.18f * (noise - v.noiseHp);
-    noise = noise - v.noiseHp;
+      if (sweep) {
+        pitchEnv *= c.pitchDecay;
+        phaseInc = static_cast<uint32_t>(c.freq * (1.0f + pitchEnv) * phaseScale_);
+      }
+      phase += phaseInc;
 
-    float sample = v.toneMix * metallic + v.noiseMix * noise;
+      // Inharmonic partials at 1.97x and 2.93x (Q16 ratios) wrap with the fundamental.
+      const uint32_t phase2 = static_cast<uint32_t>((static_cast<uint64_t>(phase) * 129106u) >> 16);
+      const uint32_t phase3 = static_cast<uint32_t>((static_cast<uint64_t>(phase) * 192020u) >> 16);
+      const float metallic = dsp::wavetableRead(sine, phase) + 0.34f * dsp::wavetableRead(sine, phase2) +
+                             0.18f * dsp::wavetableRead(sine, phase3);
+      noiseHp += 0.18f * (noiseIn[j] - noiseHp);
+      const float noise = noiseIn[j] - noiseHp;
 
-    // Remove low rumble from cymbals/hats and tame DC for all parts.
-    v.lpMem += 0.06f * (sample - v.lpMem);
-    if (i >= 2) sample -= v.lpMem;
-    v.hpMem += 0.004f * (sample - v.hpMem);
-    sample -= v.hpMem;
+      float sample = c.toneMix * metallic + c.noiseMix * noise;
 
-    sample = dsp::fastTanh(sample * (1.0f + v.drive * 3.2f));
-    const float s = sample * v.env * partGain[i] * kitMaster[kit_];
+      // Remove low rumble from cymbals, hats and toms and tame DC for all parts.
+      lpMem += 0.06f * (sample - lpMem);
+      if (lowCut) sample -= lpMem;
+      hpMem += 0.004f * (sample - hpMem);
+      sample -= hpMem;
+
+      const float s = dsp::fastTanh(sample * c.drive) * env;
+      outL[j] += s * c.gainL;
+      outR[j] += s * c.gainR;
+    }
+
+    v.env = env;
+    v.decaying = decaying;
+    v.pitchEnv = pitchEnv;
+    v.phase = phase;
+    v.noiseHp = noiseHp;
+    v.lpMem = lpMem;
+    v.hpMem = hpMem;
+  }
+}
+
+// Linear interpolation through the one-shot at its own rate, under the
+// part's envelope; the voice ends with the sample or the envelope.
+void DrumEngine::renderSampled(Voice& v, float* outL, float* outR, uint16_t n) {
+  const PartCoeffs& c = v.c;
+  const int16_t* pcm = c.pcm;
+  const uint32_t last = c.frames - 1;
+  float env = v.env;
+  bool decaying = v.decaying;
+  uint32_t pos = v.phase;
+  uint32_t frac = v.frac;
+  for (uint16_t j = 0; j < n; ++j) {
+    if (decaying) {
+      env *= c.decay;
+    } else {
+      env += c.attackInc;
+      if (env >= v.envTarget) {
+        env = v.envTarget;
+        decaying = true;
+      }
+    }
+    if ((decaying && env < 0.00015f) || pos >= last) {
+      v.active = false;
+      break;
+    }
+    const float a = static_cast<float>(pcm[pos]);
+    const float b = static_cast<float>(pcm[pos + 1]);
+    const float x = (a + (b - a) * static_cast<float>(frac) * (1.0f / 65536.0f)) * (1.0f / 32768.0f);
+    frac += c.step;
+    pos += frac >> 16;
+    frac &= 0xffffu;
 
-    outL += s * (1.0f - v.pan);
-    outR += s * v.pan;
+    const float s = x * env;
+    outL[j] += s * c.gainL;
+    outR[j] += s * c.gainR;
   }
+  v.env = env;
+  v.decaying = decaying;
+  v.phase = pos;
+  v.frac = frac;
 }
 
 }  // namespace beca
@@ -2,47 +2,159 @@
 
 #include <Arduino.h>
 
+#include "audio_platform.h"
+#include "drum_samples.h"
 #include "dsp_blocks.h"
 
 namespace beca {
 
+static constexpr uint8_t kDrumPartCount = 8;
+static constexpr uint8_t kDrumNoSample = 0xFF;
+
+enum DrumPartFlag : uint8_t {
+  DRUM_PART_LOW_CUT = 1u << 0,  // take out the body below ~430 Hz (hats, cymbals, toms)
+};
+
+// One kit part in sample-rate independent units; DrumEngine derives the
+// per-sample coefficients from it when the kit or the sample rate changes.
+struct DrumPartDef {
+  float freq;        // Hz, before the pitch sweep
+  float pitchSweep;  // starting pitch offset as a fraction of freq, 0 for none
+  float pitchDecay;  // per-sample multiplier on the sweep
+  float attackSec;   // linear rise to the hit's velocity
+  // After the attack the envelope falls exponentially, reaching decayLevel
+  // (relative to the peak) after decaySec. The part stops once the envelope
+  // is below about -76 dB.
+  float decaySec;
+  float decayLevel;
+  float toneMix;     // inharmonic sine partials
+  float noiseMix;    // highpassed noise
+  float pan;         // 0 left .. 1 right
+  float drive;       // 0..1 tanh drive
+  float gain;
+  uint8_t flags;     // DrumPartFlag
+  uint8_t chokes;    // parts this one cuts short when it is hit
+  // Sample bank entry played instead of the synthesis (under the same
+  // envelope, gain and pan), or kDrumNoSample. A part whose entry is not in
+  // the bank falls back to the synthesis.
+  uint8_t sample;
+};
+
+struct DrumKitDef {
+  float master;
+  DrumPartDef parts[kDrumPartCount];
+};
+
 class DrumEngine {
  public:
-  static constexpr uint8_t kPartCount = 8;
+  static constexpr uint8_t kPartCount = kDrumPartCount;
+  static constexpr uint16_t kMaxBlock = 128;
+  // Factory kits are a constant table in flash; user kits follow them.
+  static constexpr uint8_t kFactoryKitCount = 4;
+  static constexpr uint8_t kUserKitCount = 4;
+  static constexpr uint8_t kKitCount = kFactoryKitCount + kUserKitCount;
+  // Kit blob: "BKIT", version, part count, two reserved bytes, master, then
+  // per part eleven floats in DrumPartDef order, flags, chokes and sample.
+  // All little-endian. Version 1 blobs have no sample byte and still load.
+  static constexpr uint8_t kKitBlobVersion = 2;
+  static constexpr uint16_t kKitBlobPartBytes = 11 * 4 + 3;
+  static constexpr uint16_t kKitBlobBytes = 8 + 4 + kPartCount * kKitBlobPartBytes;
 
   DrumEngine();
   void init(float sampleRate);
+  // Derives the kit's per-sample coefficients; triggers only copy them. An
+  // empty user slot plays factory kit 0 until a kit is stored there.
   void setKit(uint8_t kit);
-  void trigger(uint8_t part, uint8_t velocity);
+  uint8_t kit() const { return kit_; }
+  // Returns true when the hit had to cut another part short (see setMaxParts).
+  bool trigger(uint8_t part, uint8_t velocity);
   void allOff();
-  void render(float& outL, float& outR);
+  // Overwrites outL/outR[0, n) with the kit's stereo mix. All parts share one
+  // noise block per kMaxBlock frames, drawn only while something is sounding.
+  void renderBlock(float* outL, float* outR, uint16_t n);
+  // True while any part is still sounding.
+  bool active() const;
+
+  // Load shedding: at most n parts sound at once. Parts over the cap, and
+  // the quietest other part when a hit goes over it, fade out over a few
+  // milliseconds. Returns the number of parts cut.
+  uint8_t setMaxParts(uint8_t n);
+  uint8_t maxParts() const { return maxParts_; }
+  // Frames rendered per sounding part since the last call, summed; divides
+  // the drum stage time into a cost per part.
+  uint32_t takePartFrames();
+
+  static const char* kitName(uint8_t kit);
+  // Any task. Values are clamped to sane ranges; a ringing part keeps the
+  // kit it was hit with, and a stored kit that is selected applies on the
+  // next setKit().
+  bool storeKit(uint8_t slot, const DrumKitDef& kit);
+  // Copies kit `kit` (factory or user); false for an empty user slot.
+  bool kitDef(uint8_t kit, DrumKitDef& out) const;
+  uint8_t userKitMask() const { return userKitMask_; }
+
+  static bool parseKitBlob(const uint8_t* data, size_t len, DrumKitDef& out);
+  // Writes kKitBlobBytes.
+  static void writeKitBlob(const DrumKitDef& kit, uint8_t* out);
+
+  // Maps a sample bank (see DrumSampleBank) and re-derives the kit. Voices
+  // keep pointers into the bank, so only while nothing renders.
+  bool openSamples(const char* name);
+  const DrumSampleBank& samples() const { return samples_; }
 
  private:
-  struct Voice {
-    bool active;
-    float env;
-    float envTarget;
-    float attackInc;
-    float decay;
-    float phase;
+  // Per-sample form of a DrumPartDef, at the current rate and kit master.
+  struct PartCoeffs {
     float freq;
-    float pitchEnv;
+    float pitchSweep;
     float pitchDecay;
+    float attackInc;
+    float decay;
     float toneMix;
     float noiseMix;
-    float pan;
     float drive;
+    float gainL;
+    float gainR;
+    uint8_t flags;
+    uint8_t chokes;
+    const int16_t* pcm;  // sampled part when set
+    uint32_t frames;
+    uint32_t step;       // Q16 bank frames per output frame
+  };
+
+  struct Voice {
+    PartCoeffs c;
+    bool active;
+    bool decaying;  // past the attack peak; the envelope only falls from here
+    float env;
+    float envTarget;
+    uint32_t phase;  // bank frame for sampled parts
+    uint32_t frac;   // Q16 below that frame
+    float pitchEnv;
     float hpMem;
     float lpMem;
     float noiseHp;
   };
 
-  void setupVoice(uint8_t part, float velNorm);
+  uint8_t cutOverCap(uint8_t keep);
+  void renderChunk(float* outL, float* outR, uint16_t n);
+  static void renderSampled(Voice& v, float* outL, float* outR, uint16_t n);
 
   float sampleRate_;
+  float phaseScale_;
+  float cutDecay_;
   uint8_t kit_;
+  uint8_t maxParts_;
+  uint32_t partFrames_;
+  PartCoeffs coeffs_[kPartCount];
   Voice voices_[kPartCount];
   dsp::Noise noise_;
+  float noiseBlock_[2 * kMaxBlock];
+  DrumSampleBank samples_;
+
+  DrumKitDef userKits_[kUserKitCount];
+  volatile uint8_t userKitMask_;
+  mutable platform::CriticalSection kitLock_;
 };
 
 }  // namespace beca
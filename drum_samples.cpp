@@ -0,0 +1,65 @@
+#include "drum_samples.h"
+
+#include <string.h>
+
+namespace beca {
+
+namespace {
+
+uint32_t readU32(const uint8_t* p) {
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16) |
+         (static_cast<uint32_t>(p[3]) << 24);
+}
+
+}  // namespace
+
+bool DrumSampleBank::open(const char* name) {
+  close();
+  if (!map_.map(name)) return false;
+  const uint8_t* d = map_.data();
+  const size_t size = map_.size();
+  if (size < 8 || memcmp(d, "BSMP", 4) != 0 || d[4] != kVersion || d[5] > kMaxSamples) {
+    map_.unmap();
+    return false;
+  }
+  const uint8_t count = d[5];
+  const uint32_t dirEnd = 8u + count * static_cast<uint32_t>(kEntryBytes);
+  bool ok = dirEnd <= size;
+  for (uint8_t i = 0; ok && i < count; ++i) {
+    const uint8_t* e = d + 8 + i * kEntryBytes;
+    const uint32_t offset = readU32(e);
+    const uint32_t frames = readU32(e + 4);
+    const uint32_t rate = readU32(e + 8);
+    ok = (offset & 1u) == 0 && offset >= dirEnd && offset <= size && frames >= 2 &&
+         frames <= (size - offset) / 2 && rate >= 8000 && rate <= 96000;
+  }
+  if (!ok) {
+    map_.unmap();
+    return false;
+  }
+  count_ = count;
+  return true;
+}
+
+void DrumSampleBank::close() {
+  map_.unmap();
+  count_ = 0;
+}
+
+bool DrumSampleBank::sample(uint8_t index, Sample& out) const {
+  if (index >= count_) return false;
+  const uint8_t* e = entry(index);
+  out.pcm = reinterpret_cast<const int16_t*>(map_.data() + readU32(e));
+  out.frames = readU32(e + 4);
+  out.sampleRate = readU32(e + 8);
+  return true;
+}
+
+bool DrumSampleBank::name(uint8_t index, char* out) const {
+  if (index >= count_) return false;
+  memcpy(out, entry(index) + 12, kNameBytes);
+  out[kNameBytes] = '\0';
+  return true;
+}
+
+}  // namespace beca
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "audio_platform.h"
+
+namespace beca {
+
+// One-shot drum samples read in place from a read-only bank: a flash data
+// partition on the device, a file on the host (see platform::MappedData).
+// Nothing is copied to RAM; a hit reads only the frames it plays.
+//
+// Bank layout, little-endian:
+//   0   "BSMP", version, sample count, two reserved bytes
+//   8   per sample: u32 offset, u32 frames, u32 sample rate, char name[12]
+//   ..  mono int16 PCM; offsets count from the start of the bank and are even
+class DrumSampleBank {
+ public:
+  static constexpr uint8_t kVersion = 1;
+  static constexpr uint8_t kMaxSamples = 64;
+  static constexpr uint8_t kNameBytes = 12;
+  static constexpr uint8_t kEntryBytes = 12 + kNameBytes;
+
+  struct Sample {
+    const int16_t* pcm;
+    uint32_t frames;
+    uint32_t sampleRate;
+  };
+
+  DrumSampleBank() : count_(0) {}
+  // Maps the bank and checks its directory; a bank with any entry outside
+  // its bounds is refused as a whole.
+  bool open(const char* name);
+  void close();
+  uint8_t count() const { return count_; }
+  bool sample(uint8_t index, Sample& out) const;
+  // NUL-terminated; out must hold kNameBytes + 1.
+  bool name(uint8_t index, char* out) const;
+
+ private:
+  const uint8_t* entry(uint8_t index) const { return map_.data() + 8 + index * kEntryBytes; }
+
+  platform::MappedData map_;
+  uint8_t count_;
+};
+
+}  // namespace beca
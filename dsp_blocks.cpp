@@ -1,5 +1,9 @@
 #include "dsp_blocks.h"
 
+#include <string.h>
+
+#include "wavetable_data.h"
+
 namespace beca {
 namespace dsp {
 
@@ -23,19 +27,71 @@ float mapCutoffLog(float norm) {
   return 20.0f * powf(900.0f, n);
 }
 
+uint32_t phaseIncrement(float hz, float sampleRate) {
+  const float inc = clampf(hz / sampleRate, 0.0f, 0.5f);
+  return static_cast<uint32_t>(inc * 4294967296.0f);
+}
+
+const int16_t* wavetable(uint8_t shape, uint32_t phaseInc) {
+  if (shape == WAVE_SINE) return kWavetableSine;
+
+  // Level L holds partials up to kWavetableSize >> L, valid while phaseInc < 2^L / (2 * kWavetableSize).
+  const uint32_t k = phaseInc >> (32 - kWavetableBits - 1);
+  uint8_t level = k == 0 ? 0 : static_cast<uint8_t>(32 - __builtin_clz(k));
+  if (level >= kWavetableLevels) level = kWavetableLevels - 1;
+
+  switch (shape) {
+    case WAVE_SAW:
+      return kWavetableSaw[level];
+    case WAVE_SQUARE:
+      return kWavetableSquare[level];
+    case WAVE_TRIANGLE:
+    default:
+      return kWavetableTriangle[level];
+  }
+}
+
+const int16_t* sineTable() {
+  return kWavetableSine;
+}
+
+namespace {
+
+// Overshoot targets for the exponential curve: attack aims past 1.0, decay and
+// release aim just below their end level so each segment finishes in its set time.
+const float kExpAttackRatio = 0.3f;
+const float kExpDecayRatio = 0.0001f;
+
+float expCoef(float seconds, float sr, float ratio) {
+  return expf(-logf((1.0f + ratio) / ratio) / (seconds * sr));
+}
+
+}  // namespace
+
 ADSR::ADSR()
     : state_(Off),
+      curve_(Linear),
       sr_(44100.0f),
       level_(0.0f),
       attackInc_(0.001f),
       decayInc_(0.001f),
       sustain_(0.7f),
-      releaseInc_(0.001f) {}
+      releaseInc_(0.001f),
+      attackCoef_(0.0f),
+      attackBase_(0.0f),
+      decayCoef_(0.0f),
+      decayBase_(0.0f),
+      releaseCoef_(0.0f),
+      releaseBase_(0.0f) {}
 
 void ADSR::setSampleRate(float sr) {
   sr_ = sr > 1000.0f ? sr : 44100.0f;
 }
 
+void ADSR::setCurve(uint8_t curve) {
+  curve_ = curve == Exponential ? Exponential : Linear;
+}
+
 void ADSR::set(float attackSec, float decaySec, float sustainLvl, float releaseSec) {
   attackSec = clampf(attackSec, 0.001f, 5.0f);
   decaySec = clampf(decaySec, 0.001f, 5.0f);
@@ -45,6 +101,15 @@ void ADSR::set(float attackSec, float decaySec, float sustainLvl, float releaseS
   attackInc_ = 1.0f / (attackSec * sr_);
   decayInc_ = (1.0f - sustain_) / (decaySec * sr_);
   releaseInc_ = 1.0f / (releaseSec * sr_);
+
+  if (curve_ == Exponential) {
+    attackCoef_ = expCoef(attackSec, sr_, kExpAttackRatio);
+    attackBase_ = (1.0f + kExpAttackRatio) * (1.0f - attackCoef_);
+    decayCoef_ = expCoef(decaySec, sr_, kExpDecayRatio);
+    decayBase_ = (sustain_ - kExpDecayRatio) * (1.0f - decayCoef_);
+    releaseCoef_ = expCoef(releaseSec, sr_, kExpDecayRatio);
+    releaseBase_ = -kExpDecayRatio * (1.0f - releaseCoef_);
+  }
 }
 
 void ADSR::noteOn() {
@@ -55,25 +120,36 @@ void ADSR::noteOff() {
   if (state_ != Off) state_ = Release;
 }
 
+void ADSR::quickRelease(float releaseSec) {
+  releaseSec = clampf(releaseSec, 0.001f, 10.0f);
+  releaseInc_ = 1.0f / (releaseSec * sr_);
+  if (curve_ == Exponential) {
+    releaseCoef_ = expCoef(releaseSec, sr_, kExpDecayRatio);
+    releaseBase_ = -kExpDecayRatio * (1.0f - releaseCoef_);
+  }
+  noteOff();
+}
+
 void ADSR::reset() {
   state_ = Off;
   level_ = 0.0f;
 }
 
 float ADSR::process() {
+  const bool exp = curve_ == Exponential;
   switch (state_) {
     case Off:
       level_ = 0.0f;
       break;
     case Attack:
-      level_ += attackInc_;
+      level_ = exp ? attackBase_ + level_ * attackCoef_ : level_ + attackInc_;
       if (level_ >= 1.0f) {
         level_ = 1.0f;
         state_ = Decay;
       }
       break;
     case Decay:
-      level_ -= decayInc_;
+      level_ = exp ? decayBase_ + level_ * decayCoef_ : level_ - decayInc_;
       if (level_ <= sustain_) {
         level_ = sustain_;
         state_ = Sustain;
@@ -83,7 +159,7 @@ float ADSR::process() {
       level_ = sustain_;
       break;
     case Release:
-      level_ -= releaseInc_;
+      level_ = exp ? releaseBase_ + level_ * releaseCoef_ : level_ - releaseInc_;
       if (level_ <= 0.0f) {
         level_ = 0.0f;
         state_ = Off;
@@ -93,6 +169,103 @@ float ADSR::process() {
   return level_;
 }
 
+uint32_t ADSR::stepsToTarget(float target) const {
+  // Samples until the current segment reaches target, counting the crossing sample.
+  const uint32_t kNever = 0xFFFFFFFFu;
+  if (curve_ == Exponential) {
+    float coef = attackCoef_;
+    float base = attackBase_;
+    if (state_ == Decay) {
+      coef = decayCoef_;
+      base = decayBase_;
+    } else if (state_ == Release) {
+      coef = releaseCoef_;
+      base = releaseBase_;
+    }
+    if (coef <= 0.0f) return 1;
+    const float asymptote = base / (1.0f - coef);
+    const float ratio = (target - asymptote) / (level_ - asymptote);
+    if (ratio >= 1.0f) return 1;
+    if (ratio <= 0.0f) return kNever;
+    const float k = ceilf(logf(ratio) / logf(coef));
+    return k < 1.0f ? 1 : (k > 4.0e9f ? kNever : static_cast<uint32_t>(k));
+  }
+
+  const float inc = state_ == Attack ? attackInc_ : (state_ == Decay ? decayInc_ : releaseInc_);
+  const float dist = state_ == Attack ? target - level_ : level_ - target;
+  if (dist <= 0.0f) return 1;
+  if (inc <= 0.0f) return kNever;
+  const float k = ceilf(dist / inc);
+  return k < 1.0f ? 1 : (k > 4.0e9f ? kNever : static_cast<uint32_t>(k));
+}
+
+uint16_t ADSR::runSegment(float* out, uint16_t i, uint16_t n, float target, State next) {
+  const uint32_t steps = stepsToTarget(target);
+  const uint16_t room = n - i;
+  const uint16_t m = steps < room ? static_cast<uint16_t>(steps) : room;
+
+  if (curve_ == Exponential) {
+    float coef = attackCoef_;
+    float base = attackBase_;
+    if (state_ == Decay) {
+      coef = decayCoef_;
+      base = decayBase_;
+    } else if (state_ == Release) {
+      coef = releaseCoef_;
+      base = releaseBase_;
+    }
+    float level = level_;
+    for (uint16_t j = 0; j < m; ++j) {
+      level = base + level * coef;
+      out[i + j] = level;
+    }
+    level_ = level;
+  } else {
+    const float inc = state_ == Attack ? attackInc_ : -(state_ == Decay ? decayInc_ : releaseInc_);
+    const float start = level_;
+    for (uint16_t j = 0; j < m; ++j) out[i + j] = start + inc * static_cast<float>(j + 1);
+    level_ = out[i + m - 1];
+  }
+
+  if (steps <= room) {
+    out[i + m - 1] = target;
+    level_ = target;
+    state_ = next;
+  }
+  return i + m;
+}
+
+uint16_t ADSR::processBlock(float* out, uint16_t n) {
+  uint16_t i = 0;
+  while (i < n) {
+    switch (state_) {
+      case Off:
+        level_ = 0.0f;
+        for (uint16_t j = i; j < n; ++j) out[j] = 0.0f;
+        return i;
+      case Attack:
+        i = runSegment(out, i, n, 1.0f, Decay);
+        break;
+      case Decay:
+        i = runSegment(out, i, n, sustain_, Sustain);
+        break;
+      case Sustain:
+        level_ = sustain_;
+        for (; i < n; ++i) out[i] = sustain_;
+        break;
+      case Release:
+        i = runSegment(out, i, n, 0.0f, Off);
+        // The sample that lands on zero is already silent, so it is not live.
+        if (state_ == Off) {
+          for (uint16_t j = i - 1; j < n; ++j) out[j] = 0.0f;
+          return i - 1;
+        }
+        break;
+    }
+  }
+  return n;
+}
+
 Biquad::Biquad()
     : b0_(1.0f), b1_(0.0f), b2_(0.0f), a1_(0.0f), a2_(0.0f), z1_(0.0f), z2_(0.0f) {}
 
@@ -109,55 +282,55 @@ void Biquad::setCoeffs(float b0, float b1, float b2, float a1, float a2) {
   a2_ = a2;
 }
 
-void Biquad::setLowpass(float sampleRate, float cutoffHz, float q) {
-  const float fc = clampf(cutoffHz, 20.0f, 18000.0f);
-  const float qq = clampf(q, 0.1f, 10.0f);
-  const float w0 = 2.0f * kPi * fc / sampleRate;
-  const float c = cosf(w0);
-  const float s = sinf(w0);
-  const float alpha = s / (2.0f * qq);
+void Biquad::setShape(uint8_t shape, float c, float s, float q) {
+  const float alpha = s / (2.0f * clampf(q, 0.1f, 10.0f));
   const float a0 = 1.0f + alpha;
-
-  const float b0 = (1.0f - c) * 0.5f / a0;
-  const float b1 = (1.0f - c) / a0;
-  const float b2 = b0;
   const float a1 = -2.0f * c / a0;
   const float a2 = (1.0f - alpha) / a0;
-  setCoeffs(b0, b1, b2, a1, a2);
+
+  switch (shape) {
+    case Lowpass: {
+      const float b0 = (1.0f - c) * 0.5f / a0;
+      setCoeffs(b0, (1.0f - c) / a0, b0, a1, a2);
+      break;
+    }
+    case Highpass: {
+      const float b0 = (1.0f + c) * 0.5f / a0;
+      setCoeffs(b0, -(1.0f + c) / a0, b0, a1, a2);
+      break;
+    }
+    case Bandpass:
+    default:
+      setCoeffs(alpha / a0, 0.0f, -alpha / a0, a1, a2);
+      break;
+  }
 }
 
-void Biquad::setHighpass(float sampleRate, float cutoffHz, float q) {
-  const float fc = clampf(cutoffHz, 20.0f, 18000.0f);
-  const float qq = clampf(q, 0.1f, 10.0f);
-  const float w0 = 2.0f * kPi * fc / sampleRate;
-  const float c = cosf(w0);
-  const float s = sinf(w0);
-  const float alpha = s / (2.0f * qq);
-  const float a0 = 1.0f + alpha;
+void Biquad::copyCoeffs(const Biquad& other) {
+  setCoeffs(other.b0_, other.b1_, other.b2_, other.a1_, other.a2_);
+}
 
-  const float b0 = (1.0f + c) * 0.5f / a0;
-  const float b1 = -(1.0f + c) / a0;
-  const float b2 = b0;
-  const float a1 = -2.0f * c / a0;
-  const float a2 = (1.0f - alpha) / a0;
-  setCoeffs(b0, b1, b2, a1, a2);
+namespace {
+
+float cutoffW0(float sampleRate, float cutoffHz) {
+  return 2.0f * kPi * clampf(cutoffHz, BiquadTable::kMinHz, BiquadTable::kMaxHz) / sampleRate;
 }
 
-void Biquad::setBandpass(float sampleRate, float cutoffHz, float q) {
-  const float fc = clampf(cutoffHz, 20.0f, 18000.0f);
-  const float qq = clampf(q, 0.1f, 10.0f);
-  const float w0 = 2.0f * kPi * fc / sampleRate;
-  const float c = cosf(w0);
-  const float s = sinf(w0);
-  const float alpha = s / (2.0f * qq);
-  const float a0 = 1.0f + alpha;
+}  // namespace
 
-  const float b0 = alpha / a0;
-  const float b1 = 0.0f;
-  const float b2 = -alpha / a0;
-  const float a1 = -2.0f * c / a0;
-  const float a2 = (1.0f - alpha) / a0;
-  setCoeffs(b0, b1, b2, a1, a2);
+void Biquad::setLowpass(float sampleRate, float cutoffHz, float q) {
+  const float w0 = cutoffW0(sampleRate, cutoffHz);
+  setShape(Lowpass, cosf(w0), sinf(w0), q);
+}
+
+void Biquad::setHighpass(float sampleRate, float cutoffHz, float q) {
+  const float w0 = cutoffW0(sampleRate, cutoffHz);
+  setShape(Highpass, cosf(w0), sinf(w0), q);
+}
+
+void Biquad::setBandpass(float sampleRate, float cutoffHz, float q) {
+  const float w0 = cutoffW0(sampleRate, cutoffHz);
+  setShape(Bandpass, cosf(w0), sinf(w0), q);
 }
 
 float Biquad::process(float x) {
@@ -167,6 +340,97 @@ float Biquad::process(float x) {
   return y;
 }
 
+constexpr float BiquadTable::kMinHz;
+constexpr float BiquadTable::kMaxHz;
+constexpr uint32_t DelayLine::kMaxLength;
+
+BiquadTable::BiquadTable() : sr_(0.0f) {}
+
+void BiquadTable::init(float sampleRate) {
+  if (sampleRate == sr_) return;
+  sr_ = sampleRate;
+  const uint16_t steps = 1u << kStepBits;
+  for (uint16_t i = 0; i < kPoints; ++i) {
+    const uint16_t octave = i / steps;
+    const uint16_t step = i % steps;
+    const float hz = static_cast<float>(1u << (kBaseOctave + octave)) *
+                     (1.0f + static_cast<float>(step) / static_cast<float>(steps));
+    const float w0 = 2.0f * kPi * hz / sampleRate;
+    cos_[i] = cosf(w0);
+    sin_[i] = sinf(w0);
+  }
+}
+
+float BiquadTable::position(float cutoffHz) const {
+  const float hz = clampf(cutoffHz, kMinHz, kMaxHz);
+  uint32_t bits;
+  memcpy(&bits, &hz, sizeof(bits));
+  const int32_t octave = static_cast<int32_t>(bits >> 23) - 127 - kBaseOctave;
+  const uint32_t mantissa = bits & 0x7fffffu;
+  return static_cast<float>(octave << kStepBits) + static_cast<float>(mantissa) * (1.0f / (1u << (23 - kStepBits)));
+}
+
+void BiquadTable::lookup(float position, float& cosW0, float& sinW0) const {
+  // Within a step the table is linear in Hz, matching how position() splits the mantissa.
+  uint16_t i = static_cast<uint16_t>(position);
+  if (i > kPoints - 2) i = kPoints - 2;
+  const float frac = position - static_cast<float>(i);
+  cosW0 = cos_[i] + (cos_[i + 1] - cos_[i]) * frac;
+  sinW0 = sin_[i] + (sin_[i + 1] - sin_[i]) * frac;
+}
+
+uint8_t encodeMuLaw(int32_t pcm) {
+  static constexpr int32_t kBias = 0x84;
+  static constexpr int32_t kClip = 32635;
+  uint8_t sign = 0;
+  if (pcm < 0) {
+    pcm = -pcm;
+    sign = 0x80;
+  }
+  if (pcm > kClip) pcm = kClip;
+  pcm += kBias;
+  // The bias puts the top bit between 7 and 14; that bit picks the segment.
+  const uint8_t exponent = static_cast<uint8_t>(31 - __builtin_clz(static_cast<uint32_t>(pcm)) - 7);
+  const uint8_t mantissa = static_cast<uint8_t>((pcm >> (exponent + 3)) & 0x0f);
+  return static_cast<uint8_t>(~(sign | (exponent << 4) | mantissa));
+}
+
+DelayLine::DelayLine()
+    : law_(nullptr), pcm_(nullptr), length_(0), pos_(0), offset_(1u << 16), step_(0), primed_(false) {}
+
+void DelayLine::attach(uint8_t* law, int16_t* pcm, uint32_t length) {
+  law_ = pcm ? nullptr : law;
+  pcm_ = pcm;
+  length_ = length < kMaxLength ? length : kMaxLength;
+  clear();
+}
+
+void DelayLine::clear() {
+  if (pcm_) {
+    memset(pcm_, 0, sizeof(int16_t) * length_);
+  } else if (law_) {
+    memset(law_, encodeMuLaw(0), length_);
+  }
+  pos_ = 0;
+  offset_ = 1u << 16;
+  step_ = 0;
+  primed_ = false;
+}
+
+void DelayLine::setDelay(float delaySamples, float glide, uint16_t n) {
+  // The tap and the sample after it must both lie behind the write head.
+  const float target = clampf(delaySamples, 1.0f, static_cast<float>(length_ - 2)) * 65536.0f;
+  if (!primed_) {
+    offset_ = static_cast<uint32_t>(target);
+    step_ = 0;
+    primed_ = true;
+    return;
+  }
+  const float current = static_cast<float>(offset_);
+  step_ = static_cast<int32_t>((target - current) * glide / static_cast<float>(n));
+  if (step_ == 0) offset_ = static_cast<uint32_t>(target);
+}
+
 DCBlocker::DCBlocker() : x1_(0.0f), y1_(0.0f) {}
 
 void DCBlocker::reset() {
@@ -182,7 +446,11 @@ float DCBlocker::process(float x) {
   return y;
 }
 
-Noise::Noise() : state_(0x1f123bb5u) {}
+Noise::Noise() : state_(kSeed) {}
+
+void Noise::reset() {
+  state_ = kSeed;
+}
 
 float Noise::next() {
   state_ ^= state_ << 13;
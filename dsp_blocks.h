@@ -8,43 +8,97 @@ namespace dsp {
 
 static constexpr float kPi = 3.14159265358979323846f;
 
+// Shared flash-resident wavetables (wavetable_data.h, from make_wavetable_header.py).
+// Saw/square/triangle are mip-mapped per octave of phase increment so every level
+// stays below Nyquist; sine is a single table.
+static constexpr uint8_t kWavetableBits = 9;
+static constexpr uint16_t kWavetableSize = 1u << kWavetableBits;
+static constexpr uint8_t kWavetableLevels = 10;
+static constexpr float kWavetablePeak = 1.25f;
+
+enum WaveShape : uint8_t { WAVE_SAW = 0, WAVE_SQUARE = 1, WAVE_TRIANGLE = 2, WAVE_SINE = 3 };
+
 float clampf(float x, float lo, float hi);
 float midiToHz(uint8_t midiNote);
 float fastTanh(float x);
 float mapCutoffLog(float norm);
 
+// Phase accumulators are full-scale uint32: 2^32 == one cycle.
+uint32_t phaseIncrement(float hz, float sampleRate);
+const int16_t* wavetable(uint8_t shape, uint32_t phaseInc);
+const int16_t* sineTable();
+
+inline float wavetableRead(const int16_t* table, uint32_t phase) {
+  static constexpr uint32_t kFracBits = 32 - kWavetableBits;
+  const uint32_t idx = phase >> kFracBits;
+  const float frac = static_cast<float>(phase & ((1u << kFracBits) - 1u)) * (1.0f / static_cast<float>(1u << kFracBits));
+  const float a = static_cast<float>(table[idx]);
+  const float b = static_cast<float>(table[idx + 1]);
+  return (a + (b - a) * frac) * (kWavetablePeak / 32767.0f);
+}
+
 class ADSR {
  public:
+  // Linear ramps by default; Exponential runs RC-style segments from per-sample multipliers.
+  enum Curve : uint8_t { Linear = 0, Exponential = 1 };
+
   ADSR();
   void setSampleRate(float sr);
+  void setCurve(uint8_t curve);
   void set(float attackSec, float decaySec, float sustainLvl, float releaseSec);
   void noteOn();
   void noteOff();
+  // noteOff() with a one-off release time, e.g. to fade out a stolen voice.
+  void quickRelease(float releaseSec);
   void reset();
   float process();
+  // Fills out[0, n) a whole segment at a time and returns the number of live samples.
+  // A result below n means the release ended inside the block and the envelope is idle.
+  uint16_t processBlock(float* out, uint16_t n);
   bool active() const { return state_ != 0; }
+  bool releasing() const { return state_ == Release; }
+  float level() const { return level_; }
 
  private:
   enum State : uint8_t { Off = 0, Attack = 1, Decay = 2, Sustain = 3, Release = 4 };
+  uint32_t stepsToTarget(float target) const;
+  uint16_t runSegment(float* out, uint16_t i, uint16_t n, float target, State next);
+
   State state_;
+  Curve curve_;
   float sr_;
   float level_;
   float attackInc_;
   float decayInc_;
   float sustain_;
   float releaseInc_;
+  float attackCoef_;
+  float attackBase_;
+  float decayCoef_;
+  float decayBase_;
+  float releaseCoef_;
+  float releaseBase_;
 };
 
 class Biquad {
  public:
+  enum Shape : uint8_t { Lowpass = 0, Highpass = 1, Bandpass = 2 };
+
   Biquad();
   void reset();
   void setLowpass(float sampleRate, float cutoffHz, float q);
   void setHighpass(float sampleRate, float cutoffHz, float q);
   void setBandpass(float sampleRate, float cutoffHz, float q);
+  // RBJ coefficients from a precomputed cos/sin of w0 (see BiquadTable).
+  void setShape(uint8_t shape, float cosW0, float sinW0, float q);
+  void copyCoeffs(const Biquad& other);
   float process(float x);
+  // Shape-specialized block loop: LP/HP have b2 == b0, BP has b1 == 0.
+  template <uint8_t S>
+  void processBlock(const float* in, float* out, uint16_t n);
 
  private:
+  friend class BiquadQ;
   void setCoeffs(float b0, float b1, float b2, float a1, float a2);
 
   float b0_;
@@ -56,6 +110,118 @@ class Biquad {
   float z2_;
 };
 
+template <uint8_t S>
+inline void Biquad::processBlock(const float* in, float* out, uint16_t n) {
+  const float b0 = b0_;
+  const float b1 = b1_;
+  const float a1 = a1_;
+  const float a2 = a2_;
+  float z1 = z1_;
+  float z2 = z2_;
+  for (uint16_t i = 0; i < n; ++i) {
+    const float x = in[i];
+    const float y = b0 * x + z1;
+    if (S == Bandpass) {
+      z1 = z2 - a1 * y;
+      z2 = -b0 * x - a2 * y;
+    } else {
+      z1 = b1 * x - a1 * y + z2;
+      z2 = b0 * x - a2 * y;
+    }
+    out[i] = y;
+  }
+  z1_ = z1;
+  z2_ = z2;
+}
+
+// cos/sin of w0 at cutoffs spaced 1/32 octave apart (piecewise: the float
+// exponent picks the octave, the top five mantissa bits the step), so a
+// cutoff maps to a table position without a log and the coefficients can be
+// rebuilt every block at control rate.
+class BiquadTable {
+ public:
+  static constexpr float kMinHz = 20.0f;
+  static constexpr float kMaxHz = 18000.0f;
+
+  BiquadTable();
+  void init(float sampleRate);
+  float sampleRate() const { return sr_; }
+  // Fractional table position of cutoffHz, clamped to kMinHz..kMaxHz.
+  float position(float cutoffHz) const;
+  void lookup(float position, float& cosW0, float& sinW0) const;
+
+ private:
+  static constexpr uint8_t kStepBits = 5;
+  static constexpr uint8_t kBaseOctave = 4;  // 16 Hz
+  static constexpr uint16_t kPoints = 11u * (1u << kStepBits) + 1u;  // 16 Hz .. 32768 Hz
+
+  float sr_;
+  float cos_[kPoints];
+  float sin_[kPoints];
+};
+
+// G.711 mu-law: 8 bits per sample with about 13 bits of dynamic range.
+uint8_t encodeMuLaw(int32_t pcm);
+inline int32_t decodeMuLaw(uint8_t code) {
+  const uint8_t u = ~code;
+  const int32_t mag = ((((u & 0x0f) << 3) + 0x84) << ((u >> 4) & 7)) - 0x84;
+  return (u & 0x80) ? -mag : mag;
+}
+
+// Mono delay line read through a fractional, linearly interpolated tap. The
+// caller owns the storage: 8-bit mu-law, or linear int16 when there is room
+// for it (PSRAM). The tap offset is Q16 samples and glides once per block.
+class DelayLine {
+ public:
+  // Longest line a Q16 tap offset can span; attach() uses no more than this.
+  static constexpr uint32_t kMaxLength = 1u << 16;
+
+  DelayLine();
+  void attach(uint8_t* law, int16_t* pcm, uint32_t length);
+  void clear();
+  uint32_t length() const { return length_; }
+  bool linear() const { return pcm_ != nullptr; }
+  // Moves the tap a fraction `glide` of the way to delaySamples, spread evenly
+  // over the next n samples; the first call after clear() jumps there.
+  void setDelay(float delaySamples, float glide, uint16_t n);
+  // Per sample: read the tap (int16 scale), then write the new input.
+  int32_t read();
+  void write(int32_t x);
+
+ private:
+  int32_t at(uint32_t idx) const { return pcm_ ? pcm_[idx] : decodeMuLaw(law_[idx]); }
+
+  uint8_t* law_;
+  int16_t* pcm_;
+  uint32_t length_;
+  uint32_t pos_;
+  uint32_t offset_;
+  int32_t step_;
+  bool primed_;
+};
+
+inline int32_t DelayLine::read() {
+  const uint32_t whole = offset_ >> 16;
+  const int32_t frac = static_cast<int32_t>((offset_ & 0xffffu) >> 1);
+  const uint32_t newer = pos_ >= whole ? pos_ - whole : pos_ + length_ - whole;
+  const uint32_t older = newer == 0 ? length_ - 1 : newer - 1;
+  const int32_t a = at(newer);
+  const int32_t b = at(older);
+  offset_ += static_cast<uint32_t>(step_);
+  return a + (((b - a) * frac) >> 15);
+}
+
+inline void DelayLine::write(int32_t x) {
+  if (x > 32767) x = 32767;
+  if (x < -32767) x = -32767;
+  if (pcm_) {
+    pcm_[pos_] = static_cast<int16_t>(x);
+  } else {
+    law_[pos_] = encodeMuLaw(x);
+  }
+  if (++pos_ >= length_) pos_ = 0;
+}
+
 class DCBlocker {
  public:
   DCBlocker();
@@ -70,9 +236,11 @@ class DCBlocker {
 class Noise {
  public:
   Noise();
+  void reset();
   float next();
 
  private:
+  static constexpr uint32_t kSeed = 0x1f123bb5u;
   uint32_t state_;
 };
 
@@ -0,0 +1,243 @@
+#include "dsp_fixed.h"
+
+namespace beca {
+namespace dsp {
+
+namespace {
+
+// Q14 samples of fastTanh() over [-8, 8), 1/32 apart, plus a guard entry.
+static constexpr uint16_t kTanhSegments = 512;
+int16_t gTanhTable[kTanhSegments + 1];
+bool gTanhReady = false;
+
+// Filter and DC blocker state carry 8 extra fractional bits over the Q15 signal.
+static constexpr uint8_t kStateShift = 8;
+static constexpr uint8_t kCoeffBits = 28;
+
+int32_t toQ28(float c) {
+  return static_cast<int32_t>(c * static_cast<float>(1 << kCoeffBits));
+}
+
+}  // namespace
+
+void initFixedTables() {
+  if (gTanhReady) return;
+  for (uint16_t i = 0; i <= kTanhSegments; ++i) {
+    const float x = -8.0f + static_cast<float>(i) / 32.0f;
+    gTanhTable[i] = static_cast<int16_t>(fastTanh(x) * 16384.0f);
+  }
+  gTanhReady = true;
+}
+
+int32_t fastTanhQ15(int32_t x) {
+  // Q15 input spans [-2^18, 2^18); each table segment covers 2^10 input steps.
+  int32_t offset = x + (1 << 18);
+  if (offset < 0) offset = 0;
+  if (offset > (1 << 19) - 1) offset = (1 << 19) - 1;
+  const int32_t idx = offset >> 10;
+  const int32_t frac = offset & 1023;
+  const int32_t a = gTanhTable[idx];
+  const int32_t b = gTanhTable[idx + 1];
+  return (a + (((b - a) * frac + 512) >> 10)) * 2;
+}
+
+ADSRq::ADSRq()
+    : state_(Off),
+      sr_(44100.0f),
+      level_(0),
+      attackInc_(1),
+      decayInc_(1),
+      sustain_(0),
+      releaseInc_(1) {}
+
+void ADSRq::setSampleRate(float sr) {
+  sr_ = sr > 1000.0f ? sr : 44100.0f;
+}
+
+void ADSRq::set(float attackSec, float decaySec, float sustainLvl, float releaseSec) {
+  attackSec = clampf(attackSec, 0.001f, 5.0f);
+  decaySec = clampf(decaySec, 0.001f, 5.0f);
+  const float sustain = clampf(sustainLvl, 0.0f, 1.0f);
+  releaseSec = clampf(releaseSec, 0.001f, 10.0f);
+
+  const float one = static_cast<float>(kQ31One);
+  // 1.0f * one rounds up to 2^31 in float, which does not fit int32.
+  sustain_ = sustain >= 1.0f ? kQ31One : static_cast<int32_t>(sustain * one);
+  attackInc_ = static_cast<int32_t>(one / (attackSec * sr_));
+  decayInc_ = static_cast<int32_t>((1.0f - sustain) * one / (decaySec * sr_));
+  releaseInc_ = static_cast<int32_t>(one / (releaseSec * sr_));
+  if (attackInc_ < 1) attackInc_ = 1;
+  if (decayInc_ < 1) decayInc_ = 1;
+  if (releaseInc_ < 1) releaseInc_ = 1;
+}
+
+void ADSRq::noteOn() {
+  state_ = Attack;
+}
+
+void ADSRq::noteOff() {
+  if (state_ != Off) state_ = Release;
+}
+
+void ADSRq::quickRelease(float releaseSec) {
+  releaseSec = clampf(releaseSec, 0.001f, 10.0f);
+  releaseInc_ = static_cast<int32_t>(static_cast<float>(kQ31One) / (releaseSec * sr_));
+  if (releaseInc_ < 1) releaseInc_ = 1;
+  noteOff();
+}
+
+void ADSRq::reset() {
+  state_ = Off;
+  level_ = 0;
+}
+
+int32_t ADSRq::process() {
+  switch (state_) {
+    case Off:
+      level_ = 0;
+      break;
+    case Attack:
+      if (level_ >= kQ31One - attackInc_) {
+        level_ = kQ31One;
+        state_ = Decay;
+      } else {
+        level_ += attackInc_;
+      }
+      break;
+    case Decay:
+      level_ -= decayInc_;
+      if (level_ <= sustain_) {
+        level_ = sustain_;
+        state_ = Sustain;
+      }
+      break;
+    case Sustain:
+      level_ = sustain_;
+      break;
+    case Release:
+      level_ -= releaseInc_;
+      if (level_ <= 0) {
+        level_ = 0;
+        state_ = Off;
+      }
+      break;
+  }
+  return level_;
+}
+
+uint16_t ADSRq::runSegment(int32_t* out, uint16_t i, uint16_t n, int32_t dist, int32_t inc, int32_t target,
+                           State next) {
+  // Integer ramps make the crossing sample exact: ceil(dist / |inc|), at least one.
+  const uint32_t step = static_cast<uint32_t>(inc < 0 ? -inc : inc);
+  const uint32_t steps = dist <= 0 ? 1u : (static_cast<uint32_t>(dist) + step - 1u) / step;
+  const uint16_t room = n - i;
+  const bool crosses = steps <= room;
+  const uint16_t m = crosses ? static_cast<uint16_t>(steps) : room;
+
+  // The crossing sample is written as the target itself, so the ramp never overshoots int32.
+  int32_t level = level_;
+  const uint16_t ramp = crosses ? m - 1 : m;
+  for (uint16_t j = 0; j < ramp; ++j) {
+    level += inc;
+    out[i + j] = level;
+  }
+  level_ = level;
+
+  if (crosses) {
+    out[i + m - 1] = target;
+    level_ = target;
+    state_ = next;
+  }
+  return i + m;
+}
+
+uint16_t ADSRq::processBlock(int32_t* out, uint16_t n) {
+  uint16_t i = 0;
+  while (i < n) {
+    switch (state_) {
+      case Off:
+        level_ = 0;
+        for (uint16_t j = i; j < n; ++j) out[j] = 0;
+        return i;
+      case Attack:
+        i = runSegment(out, i, n, kQ31One - level_, attackInc_, kQ31One, Decay);
+        break;
+      case Decay:
+        i = runSegment(out, i, n, level_ - sustain_, -decayInc_, sustain_, Sustain);
+        break;
+      case Sustain:
+        level_ = sustain_;
+        for (; i < n; ++i) out[i] = sustain_;
+        break;
+      case Release:
+        i = runSegment(out, i, n, level_, -releaseInc_, 0, Off);
+        if (state_ == Off) {
+          for (uint16_t j = i - 1; j < n; ++j) out[j] = 0;
+          return i - 1;
+        }
+        break;
+    }
+  }
+  return n;
+}
+
+BiquadQ::BiquadQ()
+    : b0_(1 << kCoeffBits), b1_(0), b2_(0), a1_(0), a2_(0), x1_(0), x2_(0), y1_(0), y2_(0) {}
+
+void BiquadQ::reset() {
+  x1_ = 0;
+  x2_ = 0;
+  y1_ = 0;
+  y2_ = 0;
+}
+
+void BiquadQ::setFrom(const Biquad& f) {
+  b0_ = toQ28(f.b0_);
+  b1_ = toQ28(f.b1_);
+  b2_ = toQ28(f.b2_);
+  a1_ = toQ28(f.a1_);
+  a2_ = toQ28(f.a2_);
+}
+
+void BiquadQ::processBlock(const int32_t* in, int32_t* out, uint16_t n) {
+  // Direct form I keeps every state at the same scale, which suits integer math.
+  int32_t x1 = x1_;
+  int32_t x2 = x2_;
+  int32_t y1 = y1_;
+  int32_t y2 = y2_;
+  for (uint16_t i = 0; i < n; ++i) {
+    const int32_t x = in[i] * (1 << kStateShift);
+    const int64_t acc = static_cast<int64_t>(b0_) * x + static_cast<int64_t>(b1_) * x1 +
+                        static_cast<int64_t>(b2_) * x2 - static_cast<int64_t>(a1_) * y1 -
+                        static_cast<int64_t>(a2_) * y2;
+    const int32_t y = static_cast<int32_t>((acc + (1 << (kCoeffBits - 1))) >> kCoeffBits);
+    x2 = x1;
+    x1 = x;
+    y2 = y1;
+    y1 = y;
+    out[i] = (y + (1 << (kStateShift - 1))) >> kStateShift;
+  }
+  x1_ = x1;
+  x2_ = x2;
+  y1_ = y1;
+  y2_ = y2;
+}
+
+DCBlockerQ::DCBlockerQ() : x1_(0), y1_(0) {}
+
+void DCBlockerQ::reset() {
+  x1_ = 0;
+  y1_ = 0;
+}
+
+int32_t DCBlockerQ::process(int32_t x) {
+  static constexpr int32_t kR = 1068373114;  // 0.995 in Q30
+  const int32_t xs = x * (1 << kStateShift);
+  const int32_t y = xs - x1_ + static_cast<int32_t>((static_cast<int64_t>(kR) * y1_ + (1 << 29)) >> 30);
+  x1_ = xs;
+  y1_ = y;
+  return (y + (1 << (kStateShift - 1))) >> kStateShift;
+}
+
+}  // namespace dsp
+}  // namespace beca
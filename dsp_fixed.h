@@ -0,0 +1,112 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "dsp_blocks.h"
+
+// Fixed-point counterparts of the float blocks in dsp_blocks.h.
+// Audio samples are Q15 carried in int32 so sums and gains keep headroom;
+// envelope levels are Q31, filter coefficients Q28 with Q23 internal state.
+// Coefficient setup still uses float (it runs at control rate only).
+
+namespace beca {
+namespace dsp {
+
+static constexpr int32_t kQ15One = 1 << 15;
+static constexpr int32_t kQ31One = 0x7FFFFFFF;
+
+inline int32_t toQ15(float x) {
+  return static_cast<int32_t>(x * static_cast<float>(kQ15One));
+}
+
+// Rounded Q15 product; plain truncation would leave a negative DC bias per stage.
+inline int32_t mulQ15(int32_t a, int32_t b) {
+  return static_cast<int32_t>((static_cast<int64_t>(a) * b + (1 << 14)) >> 15);
+}
+
+inline int16_t saturate16(int32_t x) {
+  if (x > 32767) return 32767;
+  if (x < -32767) return -32767;
+  return static_cast<int16_t>(x);
+}
+
+inline int32_t clampQ15(int32_t x) {
+  if (x > kQ15One) return kQ15One;
+  if (x < -kQ15One) return -kQ15One;
+  return x;
+}
+
+// Same interpolated lookup as wavetableRead(), in raw table units (full scale == kWavetablePeak).
+inline int32_t wavetableReadQ(const int16_t* table, uint32_t phase) {
+  static constexpr uint32_t kFracBits = 32 - kWavetableBits;
+  const uint32_t idx = phase >> kFracBits;
+  const int32_t frac = static_cast<int32_t>((phase >> (kFracBits - 15)) & 0x7FFFu);
+  const int32_t a = table[idx];
+  const int32_t b = table[idx + 1];
+  return a + (((b - a) * frac + (1 << 14)) >> 15);
+}
+
+// fastTanh() on Q15 input via an interpolated table over [-8, 8).
+void initFixedTables();
+int32_t fastTanhQ15(int32_t x);
+
+class ADSRq {
+ public:
+  ADSRq();
+  void setSampleRate(float sr);
+  void set(float attackSec, float decaySec, float sustainLvl, float releaseSec);
+  void noteOn();
+  void noteOff();
+  void quickRelease(float releaseSec);
+  void reset();
+  int32_t process();  // Q31 level
+  // Block version of process(); same contract as ADSR::processBlock(). Linear only.
+  uint16_t processBlock(int32_t* out, uint16_t n);
+  bool active() const { return state_ != 0; }
+  bool releasing() const { return state_ == Release; }
+  int32_t level() const { return level_; }
+
+ private:
+  enum State : uint8_t { Off = 0, Attack = 1, Decay = 2, Sustain = 3, Release = 4 };
+  uint16_t runSegment(int32_t* out, uint16_t i, uint16_t n, int32_t dist, int32_t inc, int32_t target, State next);
+  State state_;
+  float sr_;
+  int32_t level_;
+  int32_t attackInc_;
+  int32_t decayInc_;
+  int32_t sustain_;
+  int32_t releaseInc_;
+};
+
+class BiquadQ {
+ public:
+  BiquadQ();
+  void reset();
+  void setFrom(const Biquad& f);
+  void processBlock(const int32_t* in, int32_t* out, uint16_t n);
+
+ private:
+  int32_t b0_;
+  int32_t b1_;
+  int32_t b2_;
+  int32_t a1_;
+  int32_t a2_;
+  int32_t x1_;
+  int32_t x2_;
+  int32_t y1_;
+  int32_t y2_;
+};
+
+class DCBlockerQ {
+ public:
+  DCBlockerQ();
+  void reset();
+  int32_t process(int32_t x);
+
+ private:
+  int32_t x1_;
+  int32_t y1_;
+};
+
+}  // namespace dsp
+}  // namespace beca
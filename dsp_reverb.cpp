@@ -0,0 +1,140 @@
+#include "dsp_reverb.h"
+
+#include <string.h>
+
+namespace beca {
+namespace dsp {
+
+constexpr uint16_t Reverb::kLineLength[Reverb::kLines];
+
+namespace {
+
+// Truncating toward zero in the feedback path lets the tail die out; rounded
+// products hold small values forever (a limit cycle a few LSB high).
+inline int32_t mulQ15Decay(int32_t a, int32_t b) {
+  const int64_t p = static_cast<int64_t>(a) * b;
+  return static_cast<int32_t>(p >= 0 ? p >> 15 : -((-p) >> 15));
+}
+
+}  // namespace
+
+static_assert(sizeof(Reverb) <= Reverb::kMemoryBytes, "reverb exceeds its memory budget");
+
+Reverb::Reverb() : lite_(false) {
+  int16_t* base = lines_;
+  for (uint8_t k = 0; k < kLines; ++k) {
+    line_[k] = base;
+    base += kLineLength[k];
+    gainQ_[k] = 0;
+  }
+  dampQ_[0] = kQ15One;
+  dampQ_[1] = kQ15One;
+  clear();
+}
+
+void Reverb::init(float sampleRate, float decaySec, float dampHz) {
+  const float halfRate = sampleRate * 0.5f;
+  decaySec = clampf(decaySec, 0.1f, 10.0f);
+  for (uint8_t k = 0; k < kLines; ++k) {
+    // -60 dB after decaySec; lite mode halves both length and rate, so the gain holds.
+    const float lineSec = static_cast<float>(kLineLength[k]) / halfRate;
+    gainQ_[k] = toQ15(powf(10.0f, -3.0f * lineSec / decaySec));
+  }
+  for (uint8_t r = 0; r < 2; ++r) {
+    const float rate = halfRate / static_cast<float>(1u << r);
+    dampQ_[r] = toQ15(1.0f - expf(-2.0f * kPi * clampf(dampHz, 100.0f, rate * 0.45f) / rate));
+  }
+}
+
+void Reverb::clear() {
+  memset(lines_, 0, sizeof(lines_));
+  memset(pos_, 0, sizeof(pos_));
+  memset(damp_, 0, sizeof(damp_));
+  memset(dec_, 0, sizeof(dec_));
+  memset(upL_, 0, sizeof(upL_));
+  memset(upR_, 0, sizeof(upR_));
+}
+
+void Reverb::decimate(Decimator& d, const int32_t* in, int32_t* out, uint16_t n) {
+  int32_t* x = work_;
+  memcpy(x, d.hist, sizeof(d.hist));
+  memcpy(x + 6, in, sizeof(int32_t) * n);
+  for (uint16_t j = 0; j < n / 2; ++j) {
+    const int32_t* t = x + 2 * j;
+    out[j] = (-(t[1] + t[7]) + 9 * (t[3] + t[5]) + 16 * t[4] + 16) >> 5;
+  }
+  memcpy(d.hist, x + n, sizeof(d.hist));
+}
+
+void Reverb::interpolate(Interpolator& u, const int32_t* in, int32_t* out, uint16_t m) {
+  int32_t w1 = u.hist[0];
+  int32_t w2 = u.hist[1];
+  int32_t w3 = u.hist[2];
+  for (uint16_t j = 0; j < m; ++j) {
+    const int32_t w0 = in[j];
+    out[2 * j] = (-(w0 + w3) + 9 * (w1 + w2) + 8) >> 4;
+    out[2 * j + 1] = w1;
+    w3 = w2;
+    w2 = w1;
+    w1 = w0;
+  }
+  u.hist[0] = w1;
+  u.hist[1] = w2;
+  u.hist[2] = w3;
+}
+
+void Reverb::runNetwork(const int32_t* in, int32_t* outL, int32_t* outR, uint16_t m, uint8_t lengthShift) {
+  const int32_t dampQ = dampQ_[lengthShift];
+  for (uint16_t j = 0; j < m; ++j) {
+    int32_t d[kLines];
+    for (uint8_t k = 0; k < kLines; ++k) {
+      const uint16_t cap = kLineLength[k];
+      const uint16_t len = cap >> lengthShift;
+      const uint16_t rd = pos_[k] >= len ? pos_[k] - len : pos_[k] + cap - len;
+      damp_[k] += mulQ15(line_[k][rd] - damp_[k], dampQ);
+      d[k] = damp_[k];
+    }
+
+    // Orthonormal 4x4 Hadamard: two butterfly stages and a 1/2.
+    const int32_t a = d[0] + d[1];
+    const int32_t b = d[0] - d[1];
+    const int32_t c = d[2] + d[3];
+    const int32_t e = d[2] - d[3];
+    const int32_t h[kLines] = {(a + c) >> 1, (b + e) >> 1, (a - c) >> 1, (b - e) >> 1};
+
+    const int32_t x = in[j];
+    for (uint8_t k = 0; k < kLines; ++k) {
+      line_[k][pos_[k]] = saturate16(mulQ15Decay(h[k], gainQ_[k]) + x);
+      if (++pos_[k] >= kLineLength[k]) pos_[k] = 0;
+    }
+
+    outL[j] = (d[0] + d[2]) >> 1;
+    outR[j] = (d[1] + d[3]) >> 1;
+  }
+}
+
+void Reverb::process(const int32_t* in, int32_t* outL, int32_t* outR, uint16_t n, bool lite) {
+  if (lite != lite_) {
+    // The quarter-rate stages restart from silence; the lines keep their tails.
+    memset(&dec_[1], 0, sizeof(dec_[1]));
+    memset(&upL_[1], 0, sizeof(upL_[1]));
+    memset(&upR_[1], 0, sizeof(upR_[1]));
+    lite_ = lite;
+  }
+
+  const uint16_t half = n / 2;
+  decimate(dec_[0], in, half_, n);
+  if (lite) {
+    decimate(dec_[1], half_, quarter_, half);
+    runNetwork(quarter_, quarterL_, quarterR_, half / 2, 1);
+    interpolate(upL_[1], quarterL_, halfL_, half / 2);
+    interpolate(upR_[1], quarterR_, halfR_, half / 2);
+  } else {
+    runNetwork(half_, halfL_, halfR_, half, 0);
+  }
+  interpolate(upL_[0], halfL_, outL, half);
+  interpolate(upR_[0], halfR_, outR, half);
+}
+
+}  // namespace dsp
+}  // namespace beca
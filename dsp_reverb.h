@@ -0,0 +1,73 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "dsp_fixed.h"
+
+// Small stereo reverb for the synth bus: a four-line feedback delay network
+// with Hadamard mixing and damped feedback, run at half the output rate (a
+// quarter in lite mode) between halfband decimator and interpolator stages.
+// Samples are Q15 with int16 delay lines, so the float and fixed-point render
+// paths share it.
+//
+// The budget is fixed at compile time:
+//   memory  kLineSamples int16 of delay plus block scratch, at most kMemoryBytes
+//   work    per output frame: 2.5 multiplies for the decimator and 4 for the
+//           interpolators, plus 6 multiplies and 12 adds for the network at
+//           half rate (3 and 6 in lite mode). Nothing scales with the settings.
+
+namespace beca {
+namespace dsp {
+
+class Reverb {
+ public:
+  static constexpr uint16_t kMaxBlock = 128;
+  static constexpr uint8_t kLines = 4;
+  // Line lengths at half rate: 47..82 ms at 44.1 kHz; lite mode reads half as far back.
+  static constexpr uint16_t kLineLength[kLines] = {1031, 1327, 1523, 1801};
+  static constexpr uint32_t kLineSamples = 1031 + 1327 + 1523 + 1801;
+  static constexpr uint32_t kMemoryBytes = 14 * 1024;
+
+  Reverb();
+  // sampleRate is the output rate; decaySec is the RT60, dampHz the feedback lowpass.
+  void init(float sampleRate, float decaySec, float dampHz);
+  void clear();
+  // Mono Q15 in, wet stereo Q15 out. n must be a multiple of 4, at most kMaxBlock.
+  void process(const int32_t* in, int32_t* outL, int32_t* outR, uint16_t n, bool lite);
+
+ private:
+  // 7-tap halfband (-1, 0, 9, 16, 9, 0, -1) / 32, applied polyphase.
+  struct Decimator {
+    int32_t hist[6];
+  };
+  struct Interpolator {
+    int32_t hist[3];
+  };
+
+  void decimate(Decimator& d, const int32_t* in, int32_t* out, uint16_t n);
+  static void interpolate(Interpolator& u, const int32_t* in, int32_t* out, uint16_t m);
+  void runNetwork(const int32_t* in, int32_t* outL, int32_t* outR, uint16_t m, uint8_t lengthShift);
+
+  int16_t lines_[kLineSamples];
+  int16_t* line_[kLines];
+  uint16_t pos_[kLines];
+  int32_t damp_[kLines];
+  int32_t gainQ_[kLines];
+  int32_t dampQ_[2];
+
+  Decimator dec_[2];
+  Interpolator upL_[2];
+  Interpolator upR_[2];
+  bool lite_;
+
+  int32_t work_[kMaxBlock + 6];
+  int32_t half_[kMaxBlock / 2];
+  int32_t quarter_[kMaxBlock / 4];
+  int32_t halfL_[kMaxBlock / 2];
+  int32_t halfR_[kMaxBlock / 2];
+  int32_t quarterL_[kMaxBlock / 4];
+  int32_t quarterR_[kMaxBlock / 4];
+};
+
+}  // namespace dsp
+}  // namespace beca
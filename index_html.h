@@ -1276,7 +1276,6 @@ const char INDEX_HTML[] PROGMEM = R"BECA_UI_HTML(
       const velLab = $("velLab");
 
       const mode = $("mode");
-      const drumModeOption = mode ? mode.querySelector('option[value="3"]') : null;
       const clockSel = $("clockSel");
       const scale = $("scale");
       const tsSel = $("tsSel");
@@ -1566,11 +1565,6 @@ const char INDEX_HTML[] PROGMEM = R"BECA_UI_HTML(
         outAux.classList.toggle("active", currentOutputMode === 2);
         synthPanel.classList.toggle("hidden", currentOutputMode !== 2);
         setAuxAvailability(auxReady, auxWaitMs);
-        if (drumModeOption) drumModeOption.disabled = currentOutputMode === 2;
-        if (currentOutputMode === 2 && ((mode && mode.value) | 0) === 3) {
-          mode.value = "0";
-        }
-        syncCustomSelect(mode);
       }
 
       async function setOutputMode(nextMode) {
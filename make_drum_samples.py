@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+"""Packs WAV one-shots into a drum sample bank (drum_samples.h) for the
+"drums" flash partition. The Nth file becomes bank entry N-1, which the
+Sampled kit plays on part N-1 (kick, snare, closed hat, open hat, tom 1,
+tom 2, ride, crash).
+
+    python make_drum_samples.py kick.wav snare.wav ... -o drums.bin
+"""
+import argparse
+import struct
+import sys
+import wave
+from pathlib import Path
+
+# Keep in sync with DrumSampleBank in drum_samples.h.
+VERSION = 1
+MAX_SAMPLES = 64
+NAME_BYTES = 12
+ENTRY_BYTES = 12 + NAME_BYTES
+# Matches the drums partition in partitions_beca.csv.
+PARTITION_BYTES = 0x160000
+
+
+def read_mono16(path: Path):
+    with wave.open(str(path), "rb") as w:
+        if w.getsampwidth() != 2:
+            sys.exit(f"{path}: only 16-bit PCM WAV is supported")
+        channels = w.getnchannels()
+        rate = w.getframerate()
+        raw = w.readframes(w.getnframes())
+    samples = struct.unpack(f"<{len(raw) // 2}h", raw)
+    if channels > 1:
+        # Average the channels down to mono.
+        samples = [sum(samples[i:i + channels]) // channels for i in range(0, len(samples), channels)]
+    if len(samples) < 2:
+        sys.exit(f"{path}: too short")
+    return list(samples), rate
+
+
+def main() -> None:
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("wavs", nargs="+", type=Path)
+    ap.add_argument("-o", "--out", type=Path, default=Path("drums.bin"))
+    args = ap.parse_args()
+    if len(args.wavs) > MAX_SAMPLES:
+        sys.exit(f"at most {MAX_SAMPLES} samples")
+
+    clips = [(p, *read_mono16(p)) for p in args.wavs]
+    offset = 8 + ENTRY_BYTES * len(clips)
+    header = bytearray(b"BSMP" + bytes([VERSION, len(clips), 0, 0]))
+    pcm = bytearray()
+    for path, samples, rate in clips:
+        name = path.stem.encode("ascii", "replace")[:NAME_BYTES].ljust(NAME_BYTES, b"\0")
+        header += struct.pack("<III", offset + len(pcm), len(samples), rate) + name
+        pcm += struct.pack(f"<{len(samples)}h", *samples)
+
+    blob = bytes(header + pcm)
+    if len(blob) > PARTITION_BYTES:
+        sys.exit(f"bank is {len(blob)} bytes; the drums partition holds {PARTITION_BYTES}")
+    args.out.write_bytes(blob)
+    print(f"OK: {args.out} written — {len(clips)} samples, {len(blob)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+import math
+from pathlib import Path
+
+OUT_H = Path("wavetable_data.h")
+
+# Keep in sync with dsp_blocks.h (kWavetableBits, kWavetableLevels, kWavetablePeak).
+TABLE_BITS = 9
+TABLE_SIZE = 1 << TABLE_BITS
+LEVELS = 10
+PEAK = 1.25
+# Cap partials well below the table Nyquist so linear interpolation stays clean.
+MAX_HARMONICS = TABLE_SIZE // 3
+
+
+def harmonics_for_level(level: int) -> int:
+    # Level L is used while phaseInc < 2^L / (2 * TABLE_SIZE) cycles per sample,
+    # so its highest partial must satisfy H * inc < 0.5.
+    return max(1, min(MAX_HARMONICS, TABLE_SIZE >> level))
+
+
+def saw(p: float, h: int) -> float:
+    # Matches the naive 2p - 1 ramp.
+    return -(2.0 / math.pi) * sum(math.sin(2.0 * math.pi * k * p) / k for k in range(1, h + 1))
+
+
+def square(p: float, h: int) -> float:
+    # Matches +1 for p < 0.5, -1 otherwise.
+    return (4.0 / math.pi) * sum(math.sin(2.0 * math.pi * k * p) / k for k in range(1, h + 1, 2))
+
+
+def triangle(p: float, h: int) -> float:
+    # Matches 1 - 2|2p - 1| (-1 at p = 0, +1 at p = 0.5).
+    return -(8.0 / (math.pi * math.pi)) * sum(
+        math.cos(2.0 * math.pi * k * p) / (k * k) for k in range(1, h + 1, 2)
+    )
+
+
+def quantize(v: float) -> int:
+    return max(-32767, min(32767, int(round(v / PEAK * 32767.0))))
+
+
+def table(fn, h: int):
+    # One guard sample at the end so reads never need to wrap the index.
+    return [quantize(fn(i / TABLE_SIZE, h)) for i in range(TABLE_SIZE + 1)]
+
+
+def emit_table(values, indent: str) -> str:
+    lines = []
+    for i in range(0, len(values), 16):
+        chunk = values[i:i + 16]
+        lines.append(indent + ", ".join(str(v) for v in chunk) + ",")
+    return "\n".join(lines)
+
+
+def emit_bank(name: str, fn) -> str:
+    out = [f"const int16_t {name}[kWavetableLevels][kWavetableSize + 1] PROGMEM = {{"]
+    for level in range(LEVELS):
+        h = harmonics_for_level(level)
+        out.append(f"    {{  // level {level}, {h} harmonics")
+        out.append(emit_table(table(fn, h), "        "))
+        out.append("    },")
+    out.append("};\n")
+    return "\n".join(out)
+
+
+def main() -> None:
+    sine = [quantize(math.sin(2.0 * math.pi * i / TABLE_SIZE)) for i in range(TABLE_SIZE + 1)]
+    out = (
+        "// Auto-generated by make_wavetable_header.py — do not edit by hand\n"
+        "#pragma once\n"
+        "#include <Arduino.h>\n\n"
+        "#include \"dsp_blocks.h\"\n\n"
+        "namespace beca {\n"
+        "namespace dsp {\n\n"
+        "const int16_t kWavetableSine[kWavetableSize + 1] PROGMEM = {\n"
+        + emit_table(sine, "    ")
+        + "\n};\n\n"
+        + emit_bank("kWavetableSaw", saw)
+        + "\n"
+        + emit_bank("kWavetableSquare", square)
+        + "\n"
+        + emit_bank("kWavetableTriangle", triangle)
+        + "\n"
+        "}  // namespace dsp\n"
+        "}  // namespace beca\n"
+    )
+    OUT_H.write_text(out, encoding="utf-8")
+    print(f"OK: {OUT_H} written — {1 + 3 * LEVELS} tables of {TABLE_SIZE + 1} samples")
+
+
+if __name__ == "__main__":
+    main()
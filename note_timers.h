@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+namespace beca {
+
+// Min-heap of sample-clock deadlines, at most one per key (a MIDI note, say).
+// A position index per key makes setting, moving or cancelling a key's
+// deadline O(log N) with no search, and the heap can never be full. Deadlines
+// compare wrap-aware, so they must lie within 2^31 samples of each other.
+template <uint8_t N>
+class NoteTimers {
+ public:
+  static_assert(N < 255, "key 255 marks an unused slot");
+
+  NoteTimers() { clear(); }
+
+  void clear() {
+    size_ = 0;
+    memset(pos_, kNone, sizeof(pos_));
+  }
+
+  uint8_t size() const { return size_; }
+
+  // Earliest deadline and its key; false when nothing is pending.
+  bool top(uint8_t& key, uint32_t& at) const {
+    if (size_ == 0) return false;
+    key = key_[0];
+    at = at_[0];
+    return true;
+  }
+
+  void pop() {
+    if (size_ > 0) removeAt(0);
+  }
+
+  // Sets or moves the deadline of `key`.
+  void set(uint8_t key, uint32_t at) {
+    uint8_t i = pos_[key];
+    if (i == kNone) {
+      i = size_++;
+      key_[i] = key;
+      pos_[key] = i;
+    }
+    at_[i] = at;
+    siftDown(siftUp(i));
+  }
+
+  void cancel(uint8_t key) {
+    if (pos_[key] != kNone) removeAt(pos_[key]);
+  }
+
+ private:
+  static constexpr uint8_t kNone = 0xFF;
+
+  static bool earlier(uint32_t a, uint32_t b) { return static_cast<int32_t>(a - b) < 0; }
+
+  void place(uint8_t i, uint8_t key, uint32_t at) {
+    key_[i] = key;
+    at_[i] = at;
+    pos_[key] = i;
+  }
+
+  void removeAt(uint8_t i) {
+    pos_[key_[i]] = kNone;
+    --size_;
+    if (i == size_) return;
+    place(i, key_[size_], at_[size_]);
+    siftDown(siftUp(i));
+  }
+
+  uint8_t siftUp(uint8_t i) {
+    const uint8_t key = key_[i];
+    const uint32_t at = at_[i];
+    while (i > 0) {
+      const uint8_t parent = (i - 1) / 2;
+      if (!earlier(at, at_[parent])) break;
+      place(i, key_[parent], at_[parent]);
+      i = parent;
+    }
+    place(i, key, at);
+    return i;
+  }
+
+  void siftDown(uint8_t i) {
+    const uint8_t key = key_[i];
+    const uint32_t at = at_[i];
+    for (;;) {
+      const uint16_t left = 2u * i + 1u;
+      if (left >= size_) break;
+      uint8_t child = static_cast<uint8_t>(left);
+      if (left + 1u < size_ && earlier(at_[left + 1u], at_[left])) child = static_cast<uint8_t>(left + 1u);
+      if (!earlier(at_[child], at)) break;
+      place(i, key_[child], at_[child]);
+      i = child;
+    }
+    place(i, key, at);
+  }
+
+  uint8_t size_;
+  uint8_t key_[N];
+  uint32_t at_[N];
+  uint8_t pos_[N];
+};
+
+}  // namespace beca
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+namespace beca {
+
+// Wait-free single-producer/single-consumer ring: one task pushes, another
+// pops, and neither takes a lock or masks interrupts. Indices run freely and
+// wrap at 2^32; N must be a power of two so the slot is index & (N - 1).
+template <typename T, uint16_t N>
+class SpscRing {
+ public:
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "ring size must be a power of two");
+
+  SpscRing() : head_(0), tail_(0) {}
+
+  // Producer. Fails when fewer than `reserve` slots would be left free, so
+  // callers can keep room for events that must not be dropped.
+  bool push(const T& v, uint16_t reserve = 0) {
+    const uint32_t head = head_.load(std::memory_order_relaxed);
+    const uint32_t tail = tail_.load(std::memory_order_acquire);
+    if (head - tail >= static_cast<uint32_t>(N - reserve)) return false;
+    slots_[head & (N - 1)] = v;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Index the next push will get; events pushed earlier have smaller indices.
+  uint32_t pushIndex() const { return head_.load(std::memory_order_relaxed); }
+
+  // Consumer. `index` receives the popped event's position in push order.
+  bool pop(T& out, uint32_t& index) {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) return false;
+    out = slots_[tail & (N - 1)];
+    index = tail;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer. Reads the oldest entry without removing it; drop() removes it.
+  bool peek(T& out, uint32_t& index) const {
+    const uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) return false;
+    out = slots_[tail & (N - 1)];
+    index = tail;
+    return true;
+  }
+
+  // Consumer. Only after a successful peek().
+  void drop() { tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  // Index the next pop will get.
+  uint32_t popIndex() const { return tail_.load(std::memory_order_relaxed); }
+
+  // Consumer-side backlog; a lower bound while the producer is pushing.
+  uint16_t size() const {
+    return static_cast<uint16_t>(head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_relaxed));
+  }
+
+  // Only while neither side is running.
+  void clear() {
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+  }
+
+ private:
+  T slots_[N];
+  std::atomic<uint32_t> head_;
+  std::atomic<uint32_t> tail_;
+};
+
+}  // namespace beca
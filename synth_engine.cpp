@@ -1,57 +1,316 @@
 #include "synth_engine.h"
 
 #include <math.h>
+#include <stddef.h>
 #include <string.h>
 
 namespace beca {
 
 namespace {
 
-const char* kPresetNames[SynthEngine::kPresetCount] = {
+const char* const kPresetNames[SynthEngine::kPresetCount] = {
     "Fatty Neon Lead",  "Glass Reed Lead",  "Verdant Pad",      "Forest Choir",    "Jivari Strings",
     "Pulse Arp 1",      "Pulse Arp 2",      "Rhythm Gate",      "Thick Mono Bass", "Rubber Bass",
     "Amber Bloom Pad",  "Dawn Mist Keys",   "Velvet Hollow",    "Moon Tape Choir", "Aero Bell Wash",
     "Soft Grain Pluck", "Low Tide Organ",   "Warm Drift Mono",
 };
 
+const char* kStageNames[SYNTH_STAGE_COUNT] = {
+    "events", "voices", "filter", "drums", "delay", "reverb", "output", "i2s_wait",
+};
+
+const SynthLatencyProfile kLatencyProfiles[SYNTH_LATENCY_COUNT] = {
+    {"ultra_low", 32, 3},
+    {"normal", 64, 4},
+    {"safe", 128, 6},
+};
+
+// Load governor pacing: blocks between escalation steps, and the polyphony floor.
+const uint16_t kGovCooldownBlocks = 4;
+const uint8_t kGovMinVoices = 2;
+
+// Fade given to stolen or cut voices instead of a hard stop.
+const float kStealFadeSec = 0.005f;
+
+// Time constants of the per-block cutoff/resonance and delay-time glides.
+const float kFilterGlideSec = 0.01f;
+const float kDelayGlideSec = 0.08f;
+
+// Synth reverb room: RT60 and the feedback lowpass corner.
+const float kReverbDecaySec = 1.8f;
+const float kReverbDampHz = 5200.0f;
+// Wet level at reverb = 1.
+const float kReverbWet = 0.6f;
+
+// Where each SynthParamId lives in SynthParams, its range, and whether it glides.
+// Cutoff, resonance and delay time have their own per-block glides downstream.
+struct ParamField {
+  uint8_t offset;
+  bool isByte;
+  bool glides;
+  float lo;
+  float hi;
+};
+
+constexpr ParamField kParamFields[SYNTH_PARAM_COUNT] = {
+    {offsetof(SynthParams, preset), true, false, 0.0f, SynthEngine::kPresetCount - 1},
+    {offsetof(SynthParams, waveA), true, false, 0.0f, 3.0f},
+    {offsetof(SynthParams, waveB), true, false, 0.0f, 3.0f},
+    {offsetof(SynthParams, oscMix), false, true, 0.0f, 1.0f},
+    {offsetof(SynthParams, mono), true, false, 0.0f, 1.0f},
+    {offsetof(SynthParams, maxVoices), true, false, 1.0f, SynthEngine::kMaxVoices},
+    {offsetof(SynthParams, attack), false, false, 0.0f, 5.0f},
+    {offsetof(SynthParams, decay), false, false, 0.0f, 5.0f},
+    {offsetof(SynthParams, sustain), false, false, 0.0f, 1.0f},
+    {offsetof(SynthParams, release), false, false, 0.01f, 10.0f},
+    {offsetof(SynthParams, filterType), true, false, 0.0f, SYNTH_FILTER_BANDPASS},
+    {offsetof(SynthParams, cutoffHz), false, false, 20.0f, 18000.0f},
+    {offsetof(SynthParams, resonance), false, false, 0.1f, 10.0f},
+    {offsetof(SynthParams, reverb), false, true, 0.0f, 1.0f},
+    {offsetof(SynthParams, delayMs), false, false, 0.0f, 800.0f},
+    {offsetof(SynthParams, delayFeedback), false, true, 0.0f, 0.95f},
+    {offsetof(SynthParams, delayMix), false, true, 0.0f, 1.0f},
+    {offsetof(SynthParams, distDrive), false, true, 0.0f, 1.0f},
+    {offsetof(SynthParams, master), false, true, 0.0f, 1.0f},
+    {offsetof(SynthParams, detuneCents), false, true, 0.0f, 8.0f},
+    {offsetof(SynthParams, gainTrim), false, true, 0.45f, 1.0f},
+    {offsetof(SynthParams, drumKit), true, false, 0.0f, DrumEngine::kKitCount - 1},
+    {offsetof(SynthParams, envCurve), true, false, dsp::ADSR::Linear, dsp::ADSR::Exponential},
+};
+
+// Factory presets, in flash. Fields follow SynthParams: preset, waves A/B,
+// osc mix, mono, voices, attack/decay/sustain/release, filter, cutoff,
+// resonance, reverb, delay ms/feedback/mix, drive, master, detune, gain trim,
+// drum kit, envelope curve.
+constexpr SynthParams kFactoryPresets[SynthEngine::kPresetCount] = {
+    // Fatty Neon Lead
+    {0, 0, 1, 0.45f, 1, 1, 0.006f, 0.2f, 0.66f, 0.24f, SYNTH_FILTER_LOWPASS, 5200.0f, 1.7f,
+     0.12f, 115.0f, 0.22f, 0.12f, 0.22f, 0.6f, 4.0f, 0.95f, 0, dsp::ADSR::Linear},
+    // Glass Reed Lead
+    {1, 2, 3, 0.28f, 1, 1, 0.018f, 0.44f, 0.52f, 0.42f, SYNTH_FILTER_LOWPASS, 4200.0f, 1.05f,
+     0.16f, 150.0f, 0.18f, 0.1f, 0.04f, 0.54f, 1.2f, 0.88f, 0, dsp::ADSR::Linear},
+    // Verdant Pad
+    {2, 2, 0, 0.52f, 0, 8, 0.48f, 1.1f, 0.7f, 1.8f, SYNTH_FILTER_LOWPASS, 2400.0f, 0.7f,
+     0.34f, 330.0f, 0.33f, 0.2f, 0.03f, 0.57f, 5.0f, 0.95f, 0, dsp::ADSR::Linear},
+    // Forest Choir
+    {3, 3, 2, 0.52f, 0, 8, 0.74f, 1.08f, 0.66f, 1.85f, SYNTH_FILTER_LOWPASS, 2200.0f, 0.72f,
+     0.34f, 300.0f, 0.2f, 0.12f, 0.16f, 0.5f, 1.5f, 0.82f, 0, dsp::ADSR::Linear},
+    // Jivari Strings
+    {4, 2, 1, 0.35f, 0, 8, 0.34f, 0.96f, 0.62f, 1.32f, SYNTH_FILTER_BANDPASS, 108.0f, 4.59f,
+     0.22f, 170.0f, 0.12f, 0.08f, 0.16f, 0.48f, 0.9f, 0.74f, 0, dsp::ADSR::Linear},
+    // Pulse Arp 1
+    {5, 1, 0, 0.22f, 1, 2, 0.003f, 0.12f, 0.34f, 0.18f, SYNTH_FILTER_BANDPASS, 2100.0f, 1.8f,
+     0.1f, 90.0f, 0.21f, 0.12f, 0.16f, 0.59f, 2.0f, 0.95f, 0, dsp::ADSR::Linear},
+    // Pulse Arp 2
+    {6, 0, 1, 0.58f, 1, 2, 0.002f, 0.09f, 0.3f, 0.14f, SYNTH_FILTER_HIGHPASS, 900.0f, 1.3f,
+     0.05f, 75.0f, 0.18f, 0.1f, 0.22f, 0.58f, 1.5f, 0.95f, 0, dsp::ADSR::Linear},
+    // Rhythm Gate
+    {7, 1, 2, 0.35f, 0, 6, 0.0015f, 0.07f, 0.22f, 0.11f, SYNTH_FILTER_BANDPASS, 1600.0f, 2.2f,
+     0.08f, 130.0f, 0.24f, 0.14f, 0.2f, 0.57f, 1.2f, 0.95f, 0, dsp::ADSR::Linear},
+    // Thick Mono Bass
+    {8, 0, 1, 0.64f, 1, 1, 0.004f, 0.18f, 0.58f, 0.2f, SYNTH_FILTER_LOWPASS, 980.0f, 1.4f,
+     0.04f, 60.0f, 0.12f, 0.06f, 0.28f, 0.56f, 2.0f, 0.88f, 0, dsp::ADSR::Linear},
+    // Rubber Bass
+    {9, 2, 1, 0.41f, 1, 1, 0.007f, 0.22f, 0.48f, 0.24f, SYNTH_FILTER_LOWPASS, 1300.0f, 1.9f,
+     0.03f, 45.0f, 0.08f, 0.04f, 0.3f, 0.54f, 1.1f, 0.84f, 0, dsp::ADSR::Linear},
+    // Amber Bloom Pad
+    {10, 3, 2, 0.4f, 0, 6, 0.62f, 1.22f, 0.64f, 1.95f, SYNTH_FILTER_LOWPASS, 2400.0f, 0.6f,
+     0.34f, 340.0f, 0.24f, 0.14f, 0.02f, 0.44f, 1.8f, 0.76f, 0, dsp::ADSR::Linear},
+    // Dawn Mist Keys
+    {11, 2, 3, 0.35f, 0, 6, 0.028f, 0.54f, 0.58f, 0.68f, SYNTH_FILTER_LOWPASS, 3200.0f, 0.9f,
+     0.16f, 175.0f, 0.14f, 0.09f, 0.02f, 0.5f, 0.8f, 0.82f, 0, dsp::ADSR::Linear},
+    // Velvet Hollow
+    {12, 3, 1, 0.4f, 0, 5, 0.14f, 0.7f, 0.54f, 1.1f, SYNTH_FILTER_BANDPASS, 1380.0f, 0.95f,
+     0.22f, 200.0f, 0.16f, 0.1f, 0.03f, 0.48f, 1.1f, 0.8f, 0, dsp::ADSR::Linear},
+    // Moon Tape Choir
+    {13, 3, 0, 0.56f, 0, 6, 0.76f, 1.08f, 0.68f, 2.1f, SYNTH_FILTER_LOWPASS, 1950.0f, 0.68f,
+     0.38f, 360.0f, 0.24f, 0.16f, 0.02f, 0.42f, 1.7f, 0.72f, 0, dsp::ADSR::Linear},
+    // Aero Bell Wash
+    {14, 2, 3, 0.2f, 0, 5, 0.09f, 0.82f, 0.46f, 1.7f, SYNTH_FILTER_HIGHPASS, 450.0f, 0.85f,
+     0.32f, 275.0f, 0.23f, 0.14f, 0.02f, 0.47f, 0.7f, 0.78f, 0, dsp::ADSR::Linear},
+    // Soft Grain Pluck
+    {15, 1, 3, 0.18f, 0, 4, 0.004f, 0.24f, 0.3f, 0.38f, SYNTH_FILTER_LOWPASS, 3800.0f, 1.35f,
+     0.12f, 145.0f, 0.17f, 0.08f, 0.04f, 0.49f, 0.7f, 0.82f, 0, dsp::ADSR::Linear},
+    // Low Tide Organ
+    {16, 3, 2, 0.5f, 0, 5, 0.035f, 0.62f, 0.74f, 0.92f, SYNTH_FILTER_LOWPASS, 2100.0f, 0.74f,
+     0.19f, 210.0f, 0.15f, 0.09f, 0.03f, 0.47f, 0.9f, 0.8f, 0, dsp::ADSR::Linear},
+    // Warm Drift Mono
+    {17, 0, 3, 0.32f, 1, 1, 0.015f, 0.26f, 0.63f, 0.44f, SYNTH_FILTER_LOWPASS, 2200.0f, 1.05f,
+     0.09f, 95.0f, 0.14f, 0.08f, 0.06f, 0.48f, 1.0f, 0.8f, 0, dsp::ADSR::Linear},
+};
+
+// Every factory value must already be in its kParamFields range, so loading a
+// preset can publish it as-is.
+template <typename T, T SynthParams::*Field>
+constexpr bool presetFieldInRange(uint8_t id, uint8_t i = 0) {
+  return i >= SynthEngine::kPresetCount ||
+         (kFactoryPresets[i].*Field >= kParamFields[id].lo && kFactoryPresets[i].*Field <= kParamFields[id].hi &&
+          presetFieldInRange<T, Field>(id, i + 1));
+}
+
+constexpr bool presetIndicesMatch(uint8_t i = 0) {
+  return i >= SynthEngine::kPresetCount || (kFactoryPresets[i].preset == i && presetIndicesMatch(i + 1));
+}
+
+static_assert(presetIndicesMatch(), "factory preset index out of order");
+static_assert(presetFieldInRange<uint8_t, &SynthParams::waveA>(SYNTH_PARAM_WAVE_A), "preset wave A out of range");
+static_assert(presetFieldInRange<uint8_t, &SynthParams::waveB>(SYNTH_PARAM_WAVE_B), "preset wave B out of range");
+static_assert(presetFieldInRange<float, &SynthParams::oscMix>(SYNTH_PARAM_OSC_MIX), "preset osc mix out of range");
+static_assert(presetFieldInRange<uint8_t, &SynthParams::mono>(SYNTH_PARAM_MONO), "preset mono out of range");
+static_assert(presetFieldInRange<uint8_t, &SynthParams::maxVoices>(SYNTH_PARAM_MAX_VOICES), "preset voices out of range");
+static_assert(presetFieldInRange<float, &SynthParams::attack>(SYNTH_PARAM_ATTACK), "preset attack out of range");
+static_assert(presetFieldInRange<float, &SynthParams::decay>(SYNTH_PARAM_DECAY), "preset decay out of range");
+static_assert(presetFieldInRange<float, &SynthParams::sustain>(SYNTH_PARAM_SUSTAIN), "preset sustain out of range");
+static_assert(presetFieldInRange<float, &SynthParams::release>(SYNTH_PARAM_RELEASE), "preset release out of range");
+static_assert(presetFieldInRange<uint8_t, &SynthParams::filterType>(SYNTH_PARAM_FILTER_TYPE), "preset filter out of range");
+static_assert(presetFieldInRange<float, &SynthParams::cutoffHz>(SYNTH_PARAM_CUTOFF), "preset cutoff out of range");
+static_assert(presetFieldInRange<float, &SynthParams::resonance>(SYNTH_PARAM_RESONANCE), "preset resonance out of range");
+static_assert(presetFieldInRange<float, &SynthParams::reverb>(SYNTH_PARAM_REVERB), "preset reverb out of range");
+static_assert(presetFieldInRange<float, &SynthParams::delayMs>(SYNTH_PARAM_DELAY_MS), "preset delay time out of range");
+static_assert(presetFieldInRange<float, &SynthParams::delayFeedback>(SYNTH_PARAM_DELAY_FEEDBACK),
+              "preset delay feedback out of range");
+static_assert(presetFieldInRange<float, &SynthParams::delayMix>(SYNTH_PARAM_DELAY_MIX), "preset delay mix out of range");
+static_assert(presetFieldInRange<float, &SynthParams::distDrive>(SYNTH_PARAM_DRIVE), "preset drive out of range");
+static_assert(presetFieldInRange<float, &SynthParams::master>(SYNTH_PARAM_MASTER), "preset master out of range");
+static_assert(presetFieldInRange<float, &SynthParams::detuneCents>(SYNTH_PARAM_DETUNE), "preset detune out of range");
+static_assert(presetFieldInRange<float, &SynthParams::gainTrim>(SYNTH_PARAM_GAIN_TRIM), "preset gain trim out of range");
+static_assert(presetFieldInRange<uint8_t, &SynthParams::drumKit>(SYNTH_PARAM_DRUM_KIT), "preset drum kit out of range");
+static_assert(presetFieldInRange<uint8_t, &SynthParams::envCurve>(SYNTH_PARAM_ENV_CURVE), "preset env curve out of range");
+
+float readField(const SynthParams& p, uint8_t id) {
+  const ParamField& f = kParamFields[id];
+  const uint8_t* field = reinterpret_cast<const uint8_t*>(&p) + f.offset;
+  if (f.isByte) return static_cast<float>(*field);
+  float v;
+  memcpy(&v, field, sizeof(v));
+  return v;
+}
+
+void writeField(SynthParams& p, uint8_t id, float v) {
+  const ParamField& f = kParamFields[id];
+  uint8_t* field = reinterpret_cast<uint8_t*>(&p) + f.offset;
+  if (f.isByte) {
+    *field = static_cast<uint8_t>(v);
+  } else {
+    memcpy(field, &v, sizeof(v));
+  }
+}
+
+// In range, and whole for byte fields; NaN reads as the low end.
+float clampField(uint8_t id, float v) {
+  const ParamField& f = kParamFields[id];
+  if (v != v) v = f.lo;
+  v = dsp::clampf(v, f.lo, f.hi);
+  return f.isByte ? floorf(v + 0.5f) : v;
+}
+
+uint32_t floatBits(float v) {
+  uint32_t bits;
+  memcpy(&bits, &v, sizeof(bits));
+  return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+  float v;
+  memcpy(&v, &bits, sizeof(v));
+  return v;
+}
+
+// Index of the lowest set bit, for walking voice, parameter and note masks.
+inline uint8_t lowestBit(uint32_t mask) {
+  return static_cast<uint8_t>(__builtin_ctz(mask));
+}
+
+inline uint8_t voiceCount(uint32_t mask) {
+  return static_cast<uint8_t>(__builtin_popcount(mask));
+}
+
 }  // namespace
 
 SynthEngine::SynthEngine()
-    : i2sPort_(I2S_NUM_0),
-      sampleRate_(44100),
+    : sampleRate_(44100),
       blockSize_(64),
-      audioTaskHandle_(nullptr),
+      fixedPoint_(BECA_FIXED_POINT != 0),
+      floatOut_(nullptr),
       running_(false),
       taskAlive_(false),
-      paramMux_(portMUX_INITIALIZER_UNLOCKED),
-      activeParamSlot_(0),
-      eventMux_(portMUX_INITIALIZER_UNLOCKED),
-      eventHead_(0),
-      eventTail_(0),
+      realtime_(false),
+      taskRealtime_(false),
+      workerRun_(false),
+      workerAlive_(false),
+      paramDirty_(0),
+      paramGliding_(0),
+      paramGlide_(1.0f),
+      outMaster_(0.0f),
+      userPresetMask_(0),
+      lastStamp_(0),
+      parkedOffsBefore_(0),
+      heldOffsBefore_(0),
+      parkedAllNotesOff_(0),
+      parkedAllDrumsOff_(0),
+      eventsDropped_(0),
+      offsParked_(0),
+      eventPeak_(0),
+      sampleClock_(0),
+      anchorSeq_(0),
+      anchorSample_(0),
+      anchorUs_(0),
+      blockClock_(0),
+      drumsLive_(false),
       voiceAgeCounter_(0),
-      delayPos_(0),
-      revMemL_(0.0f),
-      revMemR_(0.0f),
       lastFilterType_(SYNTH_FILTER_LOWPASS),
-      lastCutoffHz_(0.0f),
-      lastResonance_(0.0f),
+      filterPos_(0.0f),
+      filterRes_(0.0f),
+      filterGlide_(1.0f),
       filterDirty_(true),
+      delayPcm_(nullptr),
+      delayPcmLength_(0),
+      delayGlide_(1.0f),
+      reverbLive_(false),
+      busChannels_(1),
+      jobState_(JOB_IDLE),
+      parallelSlices_(0),
+      parallelReclaims_(0),
       underruns_(0),
+      latency_(SYNTH_LATENCY_NORMAL),
+      queueUs_(0),
+      stageMark_(0),
+      deadlineCycles_(1),
+      govEnabled_(true),
+      govThresholds_((85u << 8) | 60u),
+      govResetPending_(false),
+      govPatchVoices_(kMaxVoices),
+      govMono_(false),
+      govDrumPartCycles_(0.0f),
+      govDrumHold_(0),
       fadeTarget_(1.0f),
       fadeValue_(1.0f),
       fadeStep_(0.001f),
-      testToneActive_(false),
-      testToneEndMs_(0),
       drumsEnabled_(true) {
-  memset(voices_, 0, sizeof(voices_));
-  memset(offSched_, 0, sizeof(offSched_));
-  memset(eventQueue_, 0, sizeof(eventQueue_));
-  memset(delay_, 0, sizeof(delay_));
+  voices_.activeMask = 0;
+  voices_.dyingMask = 0;
+  memset(voices_.noteVoice, kNoVoice, sizeof(voices_.noteVoice));
+  for (uint8_t i = 0; i < kMaxVoices; ++i) resetVoice(i);
+  polyGain_[0] = 0.0f;
+  for (uint8_t i = 1; i <= kMaxVoices; ++i) polyGain_[i] = 0.25f / sqrtf(static_cast<float>(i));
+  dsp::initFixedTables();
+  for (auto& w : parkedOffs_) w.store(0, std::memory_order_relaxed);
+  memset(heldOffs_, 0, sizeof(heldOffs_));
+  for (auto& c : profileBlocks_) c.store(0, std::memory_order_relaxed);
+  for (auto& c : profileUnderruns_) c.store(0, std::memory_order_relaxed);
+  delay_.attach(delayLaw_, nullptr, kMaxDelaySamples);
+  memset(blockCycles_, 0, sizeof(blockCycles_));
+  resetGovernor();
+  resetStats();
 
   SynthParams p;
   presetDefaults(0, p);
-  paramsSlots_[0] = p;
-  paramsSlots_[1] = p;
+  for (uint8_t id = 0; id < SYNTH_PARAM_COUNT; ++id) {
+    paramTargets_[id].store(floatBits(clampField(id, readField(p, id))), std::memory_order_relaxed);
+  }
+  getParams(paramTarget_);
+  paramNow_ = paramTarget_;
+  outMaster_ = paramNow_.master;
 }
 
 const char* SynthEngine::presetName(uint8_t index) {
@@ -60,516 +319,153 @@ const char* SynthEngine::presetName(uint8_t index) {
 }
 
 void SynthEngine::presetDefaults(uint8_t index, SynthParams& out) {
-  const uint8_t idx = index >= kPresetCount ? 0 : index;
-  out.preset = idx;
-  out.waveA = 0;
-  out.waveB = 3;
-  out.oscMix = 0.42f;
-  out.mono = 0;
-  out.maxVoices = 8;
-  out.attack = 0.012f;
-  out.decay = 0.24f;
-  out.sustain = 0.55f;
-  out.release = 0.42f;
-  out.filterType = SYNTH_FILTER_LOWPASS;
-  out.cutoffHz = 4200.0f;
-  out.resonance = 0.9f;
-  out.reverb = 0.18f;
-  out.delayMs = 140.0f;
-  out.delayFeedback = 0.26f;
-  out.delayMix = 0.15f;
-  out.distDrive = 0.16f;
-  out.master = 0.62f;
-  out.detuneCents = 3.5f;
-  out.gainTrim = 0.95f;
-  out.drumKit = 0;
-
-  switch (idx) {
-    case 0:  // Fatty Neon Lead
-      out.waveA = 0;
-      out.waveB = 1;
-      out.oscMix = 0.45f;
-      out.mono = 1;
-      out.maxVoices = 1;
-      out.attack = 0.006f;
-      out.decay = 0.20f;
-      out.sustain = 0.66f;
-      out.release = 0.24f;
-      out.cutoffHz = 5200.0f;
-      out.resonance = 1.7f;
-      out.reverb = 0.12f;
-      out.delayMs = 115.0f;
-      out.delayFeedback = 0.22f;
-      out.delayMix = 0.12f;
-      out.distDrive = 0.22f;
-      out.master = 0.60f;
-      out.detuneCents = 4.0f;
-      break;
-    case 1:  // Glass Reed Lead
-      out.waveA = 2;
-      out.waveB = 3;
-      out.oscMix = 0.28f;
-      out.mono = 1;
-      out.maxVoices = 1;
-      out.attack = 0.018f;
-      out.decay = 0.44f;
-      out.sustain = 0.52f;
-      out.release = 0.42f;
-      out.cutoffHz = 4200.0f;
-      out.resonance = 1.05f;
-      out.reverb = 0.16f;
-      out.delayMs = 150.0f;
-      out.delayFeedback = 0.18f;
-      out.delayMix = 0.10f;
-      out.distDrive = 0.04f;
-      out.master = 0.54f;
-      out.detuneCents = 1.2f;
-      out.gainTrim = 0.88f;
-      break;
-    case 2:  // Verdant Pad
-      out.waveA = 2;
-      out.waveB = 0;
-      out.oscMix = 0.52f;
-      out.mono = 0;
-      out.maxVoices = 8;
-      out.attack = 0.48f;
-      out.decay = 1.10f;
-      out.sustain = 0.70f;
-      out.release = 1.80f;
-      out.cutoffHz = 2400.0f;
-      out.resonance = 0.7f;
-      out.reverb = 0.34f;
-      out.delayMs = 330.0f;
-      out.delayFeedback = 0.33f;
-      out.delayMix = 0.20f;
-      out.distDrive = 0.03f;
-      out.master = 0.57f;
-      out.detuneCents = 5.0f;
-      break;
-    case 3:  // Forest Choir
-      out.waveA = 3;
-      out.waveB = 2;
-      out.oscMix = 0.52f;
-      out.attack = 0.74f;
-      out.decay = 1.08f;
-      out.sustain = 0.66f;
-      out.release = 1.85f;
-      out.cutoffHz = 2200.0f;
-      out.resonance = 0.72f;
-      out.reverb = 0.34f;
-      out.delayMs = 300.0f;
-      out.delayFeedback = 0.20f;
-      out.delayMix = 0.12f;
-      out.master = 0.50f;
-      out.detuneCents = 1.5f;
-      out.gainTrim = 0.82f;
-      break;
-    case 4:  // Jivari Strings
-      out.waveA = 2;
-      out.waveB = 1;
-      out.oscMix = 0.35f;
-      out.attack = 0.34f;
-      out.decay = 0.96f;
-      out.sustain = 0.62f;
-      out.release = 1.32f;
-      out.filterType = SYNTH_FILTER_BANDPASS;
-      out.cutoffHz = 108.0f;
-      out.resonance = 4.59f;
-      out.reverb = 0.22f;
-      out.delayMs = 170.0f;
-      out.delayFeedback = 0.12f;
-      out.delayMix = 0.08f;
-      out.master = 0.48f;
-      out.detuneCents = 0.9f;
-      out.gainTrim = 0.74f;
-      break;
-    case 5:  // Pulse Arp 1
-      out.waveA = 1;
-      out.waveB = 0;
-      out.oscMix = 0.22f;
-      out.mono = 1;
-      out.maxVoices = 2;
-      out.attack = 0.003f;
-      out.decay = 0.12f;
-      out.sustain = 0.34f;
-      out.release = 0.18f;
-      out.filterType = SYNTH_FILTER_BANDPASS;
-      out.cutoffHz = 2100.0f;
-      out.resonance = 1.8f;
-      out.reverb = 0.10f;
-      out.delayMs = 90.0f;
-      out.delayFeedback = 0.21f;
-      out.delayMix = 0.12f;
-      out.distDrive = 0.16f;
-      out.master = 0.59f;
-      out.detuneCents = 2.0f;
-      break;
-    case 6:  // Pulse Arp 2
-      out.waveA = 0;
-      out.waveB = 1;
-      out.oscMix = 0.58f;
-      out.mono = 1;
-      out.maxVoices = 2;
-      out.attack = 0.002f;
-      out.decay = 0.09f;
-      out.sustain = 0.30f;
-      out.release = 0.14f;
-      out.filterType = SYNTH_FILTER_HIGHPASS;
-      out.cutoffHz = 900.0f;
-      out.resonance = 1.3f;
-      out.reverb = 0.05f;
-      out.delayMs = 75.0f;
-      out.delayFeedback = 0.18f;
-      out.delayMix = 0.10f;
-      out.distDrive = 0.22f;
-      out.master = 0.58f;
-      out.detuneCents = 1.5f;
-      break;
-    case 7:  // Rhythm Gate
-      out.waveA = 1;
-      out.waveB = 2;
-      out.oscMix = 0.35f;
-      out.mono = 0;
-      out.maxVoices = 6;
-      out.attack = 0.0015f;
-      out.decay = 0.07f;
-      out.sustain = 0.22f;
-      out.release = 0.11f;
-      out.filterType = SYNTH_FILTER_BANDPASS;
-      out.cutoffHz = 1600.0f;
-      out.resonance = 2.2f;
-      out.reverb = 0.08f;
-      out.delayMs = 130.0f;
-      out.delayFeedback = 0.24f;
-      out.delayMix = 0.14f;
-      out.distDrive = 0.20f;
-      out.master = 0.57f;
-      out.detuneCents = 1.2f;
-      break;
-    case 8:  // Thick Mono Bass
-      out.waveA = 0;
-      out.waveB = 1;
-      out.oscMix = 0.64f;
-      out.mono = 1;
-      out.maxVoices = 1;
-      out.attack = 0.004f;
-      out.decay = 0.18f;
-      out.sustain = 0.58f;
-      out.release = 0.20f;
-      out.filterType = SYNTH_FILTER_LOWPASS;
-      out.cutoffHz = 980.0f;
-      out.resonance = 1.4f;
-      out.reverb = 0.04f;
-      out.delayMs = 60.0f;
-      out.delayFeedback = 0.12f;
-      out.delayMix = 0.06f;
-      out.distDrive = 0.28f;
-      out.master = 0.56f;
-      out.detuneCents = 2.0f;
-      out.gainTrim = 0.88f;
-      break;
-    case 9:  // Rubber Bass
-      out.waveA = 2;
-      out.waveB = 1;
-      out.oscMix = 0.41f;
-      out.mono = 1;
-      out.maxVoices = 1;
-      out.attack = 0.007f;
-      out.decay = 0.22f;
-      out.sustain = 0.48f;
-      out.release = 0.24f;
-      out.filterType = SYNTH_FILTER_LOWPASS;
-      out.cutoffHz = 1300.0f;
-      out.resonance = 1.9f;
-      out.reverb = 0.03f;
-      out.delayMs = 45.0f;
-      out.delayFeedback = 0.08f;
-      out.delayMix = 0.04f;
-      out.distDrive = 0.30f;
-      out.master = 0.54f;
-      out.detuneCents = 1.1f;
-      out.gainTrim = 0.84f;
-      break;
-    case 10:  // Amber Bloom Pad
-      out.waveA = 3;
-      out.waveB = 2;
-      out.oscMix = 0.40f;
-      out.mono = 0;
-      out.maxVoices = 6;
-      out.attack = 0.62f;
-      out.decay = 1.22f;
-      out.sustain = 0.64f;
-      out.release = 1.95f;
-      out.filterType = SYNTH_FILTER_LOWPASS;
-      out.cutoffHz = 2400.0f;
-      out.resonance = 0.60f;
-      out.reverb = 0.34f;
-      out.delayMs = 340.0f;
-      out.delayFeedback = 0.24f;
-      out.delayMix = 0.14f;
-      out.distDrive = 0.02f;
-      out.master = 0.44f;
-      out.detuneCents = 1.8f;
-      out.gainTrim = 0.76f;
-      break;
-    case 11:  // Dawn Mist Keys
-      out.waveA = 2;
-      out.waveB = 3;
-      out.oscMix = 0.35f;
-      out.mono = 0;
-      out.maxVoices = 6;
-      out.attack = 0.028f;
-      out.decay = 0.54f;
-      out.sustain = 0.58f;
-      out.release = 0.68f;
-      out.filterType = SYNTH_FILTER_LOWPASS;
-      out.cutoffHz = 3200.0f;
-      out.resonance = 0.90f;
-      out.reverb = 0.16f;
-      out.delayMs = 175.0f;
-      out.delayFeedback = 0.14f;
-      out.delayMix = 0.09f;
-      out.distDrive = 0.02f;
-      out.master = 0.50f;
-      out.detuneCents = 0.8f;
-      out.gainTrim = 0.82f;
-      break;
-    case 12:  // Velvet Hollow
-      out.waveA = 3;
-      out.waveB = 1;
-      out.oscMix = 0.40f;
-      out.mono = 0;
-      out.maxVoices = 5;
-      out.attack = 0.14f;
-      out.decay = 0.70f;
-      out.sustain = 0.54f;
-      out.release = 1.10f;
-      out.filterType = SYNTH_FILTER_BANDPASS;
-      out.cutoffHz = 1380.0f;
-      out.resonance = 0.95f;
-      out.reverb = 0.22f;
-      out.delayMs = 200.0f;
-      out.delayFeedback = 0.16f;
-      out.delayMix = 0.10f;
-      out.distDrive = 0.03f;
-      out.master = 0.48f;
-      out.detuneCents = 1.1f;
-      out.gainTrim = 0.80f;
-      break;
-    case 13:  // Moon Tape Choir
-      out.waveA = 3;
-      out.waveB = 0;
-      out.oscMix = 0.56f;
-      out.mono = 0;
-      out.maxVoices = 6;
-      out.attack = 0.76f;
-      out.decay = 1.08f;
-      out.sustain = 0.68f;
-      out.release = 2.10f;
-      out.filterType = SYNTH_FILTER_LOWPASS;
-      out.cutoffHz = 1950.0f;
-      out.resonance = 0.68f;
-      out.reverb = 0.38f;
-      out.delayMs = 360.0f;
-      out.delayFeedback = 0.24f;
-      out.delayMix = 0.16f;
-      out.distDrive = 0.02f;
-      out.master = 0.42f;
-      out.detuneCents = 1.7f;
-      out.gainTrim = 0.72f;
-      break;
-    case 14:  // Aero Bell Wash
-      out.waveA = 2;
-      out.waveB = 3;
-      out.oscMix = 0.20f;
-      out.mono = 0;
-      out.maxVoices = 5;
-      out.attack = 0.09f;
-      out.decay = 0.82f;
-      out.sustain = 0.46f;
-      out.release = 1.70f;
-      out.filterType = SYNTH_FILTER_HIGHPASS;
-      out.cutoffHz = 450.0f;
-      out.resonance = 0.85f;
-      out.reverb = 0.32f;
-      out.delayMs = 275.0f;
-      out.delayFeedback = 0.23f;
-      out.delayMix = 0.14f;
-      out.distDrive = 0.02f;
-      out.master = 0.47f;
-      out.detuneCents = 0.7f;
-      out.gainTrim = 0.78f;
-      break;
-    case 15:  // Soft Grain Pluck
-      out.waveA = 1;
-      out.waveB = 3;
-      out.oscMix = 0.18f;
-      out.mono = 0;
-      out.maxVoices = 4;
-      out.attack = 0.004f;
-      out.decay = 0.24f;
-      out.sustain = 0.30f;
-      out.release = 0.38f;
-      out.filterType = SYNTH_FILTER_LOWPASS;
-      out.cutoffHz = 3800.0f;
-      out.resonance = 1.35f;
-      out.reverb = 0.12f;
-      out.delayMs = 145.0f;
-      out.delayFeedback = 0.17f;
-      out.delayMix = 0.08f;
-      out.distDrive = 0.04f;
-      out.master = 0.49f;
-      out.detuneCents = 0.7f;
-      out.gainTrim = 0.82f;
-      break;
-    case 16:  // Low Tide Organ
-      out.waveA = 3;
-      out.waveB = 2;
-      out.oscMix = 0.50f;
-      out.mono = 0;
-      out.maxVoices = 5;
-      out.attack = 0.035f;
-      out.decay = 0.62f;
-      out.sustain = 0.74f;
-      out.release = 0.92f;
-      out.filterType = SYNTH_FILTER_LOWPASS;
-      out.cutoffHz = 2100.0f;
-      out.resonance = 0.74f;
-      out.reverb = 0.19f;
-      out.delayMs = 210.0f;
-      out.delayFeedback = 0.15f;
-      out.delayMix = 0.09f;
-      out.distDrive = 0.03f;
-      out.master = 0.47f;
-      out.detuneCents = 0.9f;
-      out.gainTrim = 0.80f;
-      break;
-    case 17:  // Warm Drift Mono
-      out.waveA = 0;
-      out.waveB = 3;
-      out.oscMix = 0.32f;
-      out.mono = 1;
-      out.maxVoices = 1;
-      out.attack = 0.015f;
-      out.decay = 0.26f;
-      out.sustain = 0.63f;
-      out.release = 0.44f;
-      out.filterType = SYNTH_FILTER_LOWPASS;
-      out.cutoffHz = 2200.0f;
-      out.resonance = 1.05f;
-      out.reverb = 0.09f;
-      out.delayMs = 95.0f;
-      out.delayFeedback = 0.14f;
-      out.delayMix = 0.08f;
-      out.distDrive = 0.06f;
-      out.master = 0.48f;
-      out.detuneCents = 1.0f;
-      out.gainTrim = 0.80f;
-      break;
-  }
+  memcpy(&out, &kFactoryPresets[index >= kPresetCount ? 0 : index], sizeof(out));
 }
 
-void SynthEngine::sanitizeParams(SynthParams& p) const {
-  p.preset = p.preset >= kPresetCount ? 0 : p.preset;
-  p.waveA = p.waveA > 3 ? 3 : p.waveA;
-  p.waveB = p.waveB > 3 ? 3 : p.waveB;
-  p.oscMix = dsp::clampf(p.oscMix, 0.0f, 1.0f);
-  p.mono = p.mono ? 1 : 0;
-  p.maxVoices = static_cast<uint8_t>(constrain(static_cast<int>(p.maxVoices), 1, kMaxVoices));
-  p.attack = dsp::clampf(p.attack, 0.0f, 5.0f);
-  p.decay = dsp::clampf(p.decay, 0.0f, 5.0f);
-  p.sustain = dsp::clampf(p.sustain, 0.0f, 1.0f);
-  p.release = dsp::clampf(p.release, 0.01f, 10.0f);
-  p.filterType = p.filterType > SYNTH_FILTER_BANDPASS ? SYNTH_FILTER_BANDPASS : p.filterType;
-  p.cutoffHz = dsp::clampf(p.cutoffHz, 20.0f, 18000.0f);
-  p.resonance = dsp::clampf(p.resonance, 0.1f, 10.0f);
-  p.reverb = dsp::clampf(p.reverb, 0.0f, 1.0f);
-  p.delayMs = dsp::clampf(p.delayMs, 0.0f, 800.0f);
-  p.delayFeedback = dsp::clampf(p.delayFeedback, 0.0f, 0.95f);
-  p.delayMix = dsp::clampf(p.delayMix, 0.0f, 1.0f);
-  p.distDrive = dsp::clampf(p.distDrive, 0.0f, 1.0f);
-  p.master = dsp::clampf(p.master, 0.0f, 1.0f);
-  p.detuneCents = dsp::clampf(p.detuneCents, 0.0f, 8.0f);
-  p.gainTrim = dsp::clampf(p.gainTrim, 0.45f, 1.0f);
-  p.drumKit = p.drumKit > 2 ? 2 : p.drumKit;
-
-  if (p.delayFeedback > 0.92f && p.delayMix > 0.75f) {
-    p.delayFeedback = 0.92f;
-  }
-  if (p.distDrive > 0.8f) p.master *= 0.92f;
+const SynthLatencyProfile& SynthEngine::latencyProfile(uint8_t latency) {
+  return kLatencyProfiles[latency < SYNTH_LATENCY_COUNT ? latency : static_cast<uint8_t>(SYNTH_LATENCY_NORMAL)];
+}
+
+float SynthEngine::latencyMs(uint8_t latency, uint32_t sampleRate) {
+  const SynthLatencyProfile& lp = latencyProfile(latency);
+  const uint32_t frames = static_cast<uint32_t>(kStampLatencyBlocks + lp.bufferCount) * lp.blockSize;
+  return 1000.0f * static_cast<float>(frames) / static_cast<float>(sampleRate ? sampleRate : 1);
 }
 
-bool SynthEngine::start(int pinBck, int pinWs, int pinData, uint32_t sampleRate, uint16_t blockSize) {
+bool SynthEngine::start(int pinBck, int pinWs, int pinData, uint32_t sampleRate, uint8_t latency) {
   if (running_) return true;
 
+  latency_ = latency < SYNTH_LATENCY_COUNT ? latency : static_cast<uint8_t>(SYNTH_LATENCY_NORMAL);
+  const SynthLatencyProfile& lp = kLatencyProfiles[latency_];
+  static_assert(kBlockMax >= 128, "the safe profile renders 128-frame blocks");
   sampleRate_ = sampleRate < 22050 ? 22050 : sampleRate;
-  blockSize_ = static_cast<uint16_t>(constrain(static_cast<int>(blockSize), 32, static_cast<int>(kBlockMax)));
-
-  i2s_config_t cfg = {};
-  cfg.mode = static_cast<i2s_mode_t>(I2S_MODE_MASTER | I2S_MODE_TX);
-  cfg.sample_rate = static_cast<int>(sampleRate_);
-  cfg.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
-  cfg.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
-  cfg.communication_format = I2S_COMM_FORMAT_STAND_I2S;
-  cfg.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
-  cfg.dma_buf_count = 6;
-  cfg.dma_buf_len = blockSize_;
-  cfg.use_apll = false;
-  cfg.tx_desc_auto_clear = true;
-  cfg.fixed_mclk = 0;
-
-  i2s_pin_config_t pinCfg = {};
-  pinCfg.bck_io_num = pinBck;
-  pinCfg.ws_io_num = pinWs;
-  pinCfg.data_out_num = pinData;
-  pinCfg.data_in_num = I2S_PIN_NO_CHANGE;
-
-  if (i2s_driver_install(i2sPort_, &cfg, 0, nullptr) != ESP_OK) return false;
-  if (i2s_set_pin(i2sPort_, &pinCfg) != ESP_OK) {
-    i2s_driver_uninstall(i2sPort_);
+  blockSize_ = lp.blockSize;
+  queueUs_ = static_cast<uint32_t>((static_cast<uint64_t>(blockSize_) * lp.bufferCount * 1000000u) / sampleRate_);
+
+  platform::AudioOutConfig cfg;
+  cfg.pinBck = pinBck;
+  cfg.pinWs = pinWs;
+  cfg.pinData = pinData;
+  cfg.sampleRate = sampleRate_;
+  cfg.framesPerBuffer = blockSize_;
+  cfg.bufferCount = lp.bufferCount;
+  if (!audioOut_.begin(cfg)) return false;
+
+  resetRenderState();
+
+  running_ = true;
+  taskAlive_ = true;
+  // By default the audio task shares priority 1 with the loop task so web/Wi-Fi
+  // servicing is not starved; real-time mode expects that work on the other core.
+  taskRealtime_ = realtime_;
+  const uint8_t priority = taskRealtime_ ? platform::kRealtimePriority : 1;
+  if (!platform::startTask(taskTrampoline, "beca_audio", 6144, this, priority, 1)) {
+    running_ = false;
+    taskAlive_ = false;
+    audioOut_.end();
     return false;
   }
-  i2s_zero_dma_buffer(i2sPort_);
 
-  memset(delay_, 0, sizeof(delay_));
-  delayPos_ = 0;
-  revMemL_ = 0.0f;
-  revMemR_ = 0.0f;
+  return true;
+}
+
+void SynthEngine::startOffline(uint32_t sampleRate, uint16_t blockSize) {
+  if (running_) return;
+  sampleRate_ = sampleRate < 22050 ? 22050 : sampleRate;
+  // Multiple of 4 so the quarter-rate reverb stage sees whole samples.
+  blockSize_ = static_cast<uint16_t>(constrain(static_cast<int>(blockSize), 32, static_cast<int>(kBlockMax))) & ~3u;
+  resetRenderState();
+}
+
+const int16_t* SynthEngine::renderOffline() {
+  renderNextBlock();
+  governLoad(recordBlockStats());
+  return i2sBlock_;
+}
+
+const int16_t* SynthEngine::renderOffline(float* out) {
+  floatOut_ = out;
+  renderNextBlock();
+  governLoad(recordBlockStats());
+  floatOut_ = nullptr;
+  return i2sBlock_;
+}
+
+void SynthEngine::attachDelayStorage() {
+  // A linear 16-bit line in PSRAM when the board has it, else the internal mu-law line.
+  // High sample rates can ask for more than a Q16 tap reaches; the rest would go unused.
+  uint32_t wanted = (sampleRate_ * kMaxDelayMs) / 1000u + 2u;
+  if (wanted > dsp::DelayLine::kMaxLength) wanted = dsp::DelayLine::kMaxLength;
+  if (delayPcmLength_ < wanted) {
+    platform::freeExternal(delayPcm_);
+    delayPcm_ = static_cast<int16_t*>(platform::allocExternal(sizeof(int16_t) * wanted));
+    delayPcmLength_ = delayPcm_ ? wanted : 0;
+  }
+  if (delayPcm_) {
+    delay_.attach(nullptr, delayPcm_, delayPcmLength_);
+  } else {
+    delay_.attach(delayLaw_, nullptr, kMaxDelaySamples);
+  }
+}
+
+void SynthEngine::resetRenderState() {
+  attachDelayStorage();
+  delayGlide_ = 1.0f - expf(-static_cast<float>(blockSize_) / (kDelayGlideSec * static_cast<float>(sampleRate_)));
+  reverb_.init(static_cast<float>(sampleRate_), kReverbDecaySec, kReverbDampHz);
+  reverb_.clear();
+  reverbLive_ = false;
   dcL_.reset();
   dcR_.reset();
-  filterL_.reset();
-  filterR_.reset();
+  dcQL_.reset();
+  dcQR_.reset();
+  filter_.reset();
+  filterQ_.reset();
+  filterTable_.init(static_cast<float>(sampleRate_));
+  filterGlide_ = 1.0f - expf(-static_cast<float>(blockSize_) / (kFilterGlideSec * static_cast<float>(sampleRate_)));
   filterDirty_ = true;
 
-  for (auto& v : voices_) {
-    v.active = false;
-    v.age = 0;
-    v.phaseA = 0.0f;
-    v.phaseB = 0.0f;
-    v.vel = 0.0f;
-    v.env.setSampleRate(static_cast<float>(sampleRate_));
-    v.env.reset();
+  // Start on the targets rather than gliding up from whatever came before.
+  paramDirty_.store(0, std::memory_order_relaxed);
+  getParams(paramTarget_);
+  paramNow_ = paramTarget_;
+  paramGliding_ = 0;
+  paramGlide_ = 1.0f - expf(-static_cast<float>(blockSize_) * 1000.0f / (kParamGlideMs * static_cast<float>(sampleRate_)));
+  outMaster_ = paramNow_.master;
+
+  voices_.activeMask = 0;
+  voices_.dyingMask = 0;
+  memset(voices_.noteVoice, kNoVoice, sizeof(voices_.noteVoice));
+  for (uint8_t i = 0; i < kMaxVoices; ++i) {
+    resetVoice(i);
+    voices_.env[i].setSampleRate(static_cast<float>(sampleRate_));
+    voices_.envQ[i].setSampleRate(static_cast<float>(sampleRate_));
   }
-  memset(offSched_, 0, sizeof(offSched_));
+  gates_.clear();
   drum_.init(static_cast<float>(sampleRate_));
+  drum_.setKit(paramTarget_.drumKit);
+
+  // Neither task is rendering, and anything still queued was stamped on the
+  // previous clock; the voices it would touch were just reset anyway.
+  events_.clear();
+  for (auto& w : parkedOffs_) w.store(0, std::memory_order_relaxed);
+  parkedOffsBefore_.store(0, std::memory_order_relaxed);
+  parkedAllNotesOff_.store(0, std::memory_order_relaxed);
+  parkedAllDrumsOff_.store(0, std::memory_order_relaxed);
+  memset(heldOffs_, 0, sizeof(heldOffs_));
+  heldOffsBefore_ = 0;
+  lastStamp_ = 0;
+  blockClock_ = 0;
+  sampleClock_.store(0, std::memory_order_release);
+  publishClockAnchor(micros());
 
   fadeValue_ = 0.0f;
   fadeTarget_ = 1.0f;
   fadeStep_ = 1.0f / static_cast<float>((sampleRate_ * 20) / 1000);
 
-  running_ = true;
-  taskAlive_ = true;
-  // Keep audio task at same priority as loop task so web/Wi-Fi servicing is not starved.
-  BaseType_t ok = xTaskCreatePinnedToCore(taskTrampoline, "beca_audio", 6144, this, 1, &audioTaskHandle_, 1);
-  if (ok != pdPASS) {
-    running_ = false;
-    taskAlive_ = false;
-    i2s_driver_uninstall(i2sPort_);
-    audioTaskHandle_ = nullptr;
-    return false;
-  }
-
-  return true;
+  deadlineCycles_ = static_cast<uint32_t>((static_cast<uint64_t>(blockSize_) * 1000000u * platform::cyclesPerUs()) / sampleRate_);
+  if (deadlineCycles_ == 0) deadlineCycles_ = 1;
+  resetGovernor();
+  resetStats();
 }
 
 void SynthEngine::stop() {
@@ -583,12 +479,8 @@ void SynthEngine::stop() {
     delay(2);
   }
 
-  i2s_zero_dma_buffer(i2sPort_);
-  i2s_stop(i2sPort_);
-  i2s_driver_uninstall(i2sPort_);
+  audioOut_.end();
 
-  audioTaskHandle_ = nullptr;
-  memset(offSched_, 0, sizeof(offSched_));
   allNotesOff();
   allDrumsOff();
 }
@@ -605,117 +497,396 @@ void SynthEngine::fadeOut(uint16_t ms) {
   fadeStep_ = 1.0f / static_cast<float>((sampleRate_ * m) / 1000);
 }
 
-void SynthEngine::setParams(const SynthParams& params) {
-  SynthParams p = params;
-  sanitizeParams(p);
+// Control task only.
+void SynthEngine::setParam(uint8_t id, float value) {
+  if (id >= SYNTH_PARAM_COUNT) return;
+  const uint32_t bits = floatBits(clampField(id, value));
+  if (paramTargets_[id].load(std::memory_order_relaxed) == bits) return;
+  paramTargets_[id].store(bits, std::memory_order_relaxed);
+  paramDirty_.fetch_or(1u << id, std::memory_order_release);
+}
 
-  portENTER_CRITICAL(&paramMux_);
-  const uint8_t next = activeParamSlot_ ^ 1u;
-  paramsSlots_[next] = p;
-  activeParamSlot_ = next;
-  portEXIT_CRITICAL(&paramMux_);
+// Control task only. For params already in range (factory presets are checked
+// at compile time, user slots when stored): no clamping, one dirty update.
+void SynthEngine::publishParams(const SynthParams& params) {
+  uint32_t changed = 0;
+  for (uint8_t id = 0; id < SYNTH_PARAM_COUNT; ++id) {
+    const uint32_t bits = floatBits(readField(params, id));
+    if (paramTargets_[id].load(std::memory_order_relaxed) == bits) continue;
+    paramTargets_[id].store(bits, std::memory_order_relaxed);
+    changed |= 1u << id;
+  }
+  if (changed) paramDirty_.fetch_or(changed, std::memory_order_release);
+}
 
-  filterDirty_ = true;
-  drum_.setKit(p.drumKit);
+float SynthEngine::param(uint8_t id) const {
+  if (id >= SYNTH_PARAM_COUNT) return 0.0f;
+  return bitsFloat(paramTargets_[id].load(std::memory_order_relaxed));
+}
+
+// Only fields that differ from their current target are republished.
+void SynthEngine::setParams(const SynthParams& params) {
+  for (uint8_t id = 0; id < SYNTH_PARAM_COUNT; ++id) setParam(id, readField(params, id));
 }
 
 void SynthEngine::getParams(SynthParams& out) const {
-  portENTER_CRITICAL(&paramMux_);
-  out = paramsSlots_[activeParamSlot_];
-  portEXIT_CRITICAL(&paramMux_);
+  for (uint8_t id = 0; id < SYNTH_PARAM_COUNT; ++id) writeField(out, id, param(id));
+}
+
+// Audio task only: reads the fields changed since the last block, then moves
+// each gliding field one block-rate step toward its target.
+void SynthEngine::pullParams() {
+  const uint32_t dirty = paramDirty_.exchange(0, std::memory_order_acquire);
+  for (uint32_t m = dirty; m; m &= m - 1) {
+    const uint8_t id = lowestBit(m);
+    const float v = bitsFloat(paramTargets_[id].load(std::memory_order_relaxed));
+    writeField(paramTarget_, id, v);
+    if (kParamFields[id].glides) {
+      paramGliding_ |= 1u << id;
+    } else {
+      writeField(paramNow_, id, v);
+    }
+  }
+  if (dirty & (1u << SYNTH_PARAM_DRUM_KIT)) drum_.setKit(paramTarget_.drumKit);
+
+  for (uint32_t m = paramGliding_; m; m &= m - 1) {
+    const uint8_t id = lowestBit(m);
+    const float target = readField(paramTarget_, id);
+    float v = readField(paramNow_, id);
+    v += (target - v) * paramGlide_;
+    if (fabsf(target - v) < 1e-4f) {
+      v = target;
+      paramGliding_ &= ~(1u << id);
+    }
+    writeField(paramNow_, id, v);
+  }
 }
 
 void SynthEngine::loadPreset(uint8_t presetIndex) {
   SynthParams p;
   presetDefaults(presetIndex, p);
-  setParams(p);
+  publishParams(p);
 }
 
 void SynthEngine::resetPreset() {
+  loadPreset(static_cast<uint8_t>(param(SYNTH_PARAM_PRESET)));
+}
+
+bool SynthEngine::storeUserPreset(uint8_t slot, const SynthParams& params) {
+  if (slot >= kUserPresetCount) return false;
+  SynthParams& u = userPresets_[slot];
+  for (uint8_t id = 0; id < SYNTH_PARAM_COUNT; ++id) writeField(u, id, clampField(id, readField(params, id)));
+  userPresetMask_ |= static_cast<uint8_t>(1u << slot);
+  return true;
+}
+
+bool SynthEngine::userPreset(uint8_t slot, SynthParams& out) const {
+  if (slot >= kUserPresetCount || !(userPresetMask_ & (1u << slot))) return false;
+  memcpy(&out, &userPresets_[slot], sizeof(out));
+  return true;
+}
+
+bool SynthEngine::loadUserPreset(uint8_t slot) {
   SynthParams p;
-  getParams(p);
-  presetDefaults(p.preset, p);
-  setParams(p);
+  if (!userPreset(slot, p)) return false;
+  publishParams(p);
+  return true;
 }
 
 bool SynthEngine::triggerTestChord(uint32_t durationMs) {
   if (!running_) return false;
-  testNotes_[0] = 60;
-  testNotes_[1] = 64;
-  testNotes_[2] = 67;
-  noteOn(testNotes_[0], 92, 0);
-  noteOn(testNotes_[1], 86, 0);
-  noteOn(testNotes_[2], 88, 0);
-  testToneActive_ = true;
-  testToneEndMs_ = millis() + durationMs;
+  const uint32_t at = sampleTimeNow();
+  const uint32_t gate = msToSamples(durationMs == 0 ? 1 : durationMs);
+  pushEvent(at, EVT_NOTE_ON, 60, 92, gate);
+  pushEvent(at, EVT_NOTE_ON, 64, 86, gate);
+  pushEvent(at, EVT_NOTE_ON, 67, 88, gate);
   return true;
 }
 
-void SynthEngine::service(uint32_t nowMs) {
-  for (auto& s : offSched_) {
-    if (!s.active) continue;
-    if ((int32_t)(nowMs - s.atMs) >= 0) {
-      noteOff(s.note);
-      s.active = false;
-    }
+uint32_t SynthEngine::consumeUnderruns() {
+  return underruns_.exchange(0, std::memory_order_relaxed);
+}
+
+void SynthEngine::getStats(SynthStats& out) const {
+  const float perUs = static_cast<float>(platform::cyclesPerUs());
+  statsLock_.enter();
+  out.blocks = statBlocks_;
+  out.overruns = statOverruns_;
+  out.deadlineUs = static_cast<float>(deadlineCycles_) / perUs;
+  for (uint8_t s = 0; s <= SYNTH_STAGE_COUNT; ++s) {
+    const StageAccum& a = stageAccum_[s];
+    SynthStats::Timing& t = s < SYNTH_STAGE_COUNT ? out.stage[s] : out.render;
+    t.minUs = statBlocks_ ? static_cast<float>(a.minCycles) / perUs : 0.0f;
+    t.maxUs = static_cast<float>(a.maxCycles) / perUs;
+    t.avgUs = statBlocks_ ? static_cast<float>(a.sumCycles / statBlocks_) / perUs : 0.0f;
+  }
+  memcpy(out.loadHist, loadHist_, sizeof(loadHist_));
+  out.voiceCap = voiceCap_;
+  out.fxLite = fxLite_ ? 1 : 0;
+  out.voicesShed = govShed_;
+  out.fxLiteSteps = govFxLiteSteps_;
+  out.capSteps = govCapSteps_;
+  out.restoreSteps = govRestoreSteps_;
+  out.drumCap = drum_.maxParts();
+  out.drumCuts = govDrumCuts_;
+  out.eventPeak = eventPeak_;
+  statsLock_.exit();
+  out.eventsDropped = eventsDropped_.load(std::memory_order_relaxed);
+  out.offsParked = offsParked_.load(std::memory_order_relaxed);
+  out.parallelSlices = parallelSlices_;
+  out.parallelReclaims = parallelReclaims_;
+  out.latency = latency_;
+  out.latencyMs = latencyMs(latency_, sampleRate_);
+  for (uint8_t l = 0; l < SYNTH_LATENCY_COUNT; ++l) {
+    out.profileBlocks[l] = profileBlocks_[l].load(std::memory_order_relaxed);
+    out.profileUnderruns[l] = profileUnderruns_[l].load(std::memory_order_relaxed);
+  }
+}
+
+void SynthEngine::resetStats() {
+  statsLock_.enter();
+  for (auto& a : stageAccum_) {
+    a.minCycles = 0xFFFFFFFFu;
+    a.maxCycles = 0;
+    a.sumCycles = 0;
   }
+  statBlocks_ = 0;
+  statOverruns_ = 0;
+  memset(loadHist_, 0, sizeof(loadHist_));
+  govShed_ = 0;
+  govFxLiteSteps_ = 0;
+  govCapSteps_ = 0;
+  govRestoreSteps_ = 0;
+  govDrumCuts_ = 0;
+  eventPeak_ = 0;
+  parallelSlices_ = 0;
+  parallelReclaims_ = 0;
+  statsLock_.exit();
+  eventsDropped_.store(0, std::memory_order_relaxed);
+  offsParked_.store(0, std::memory_order_relaxed);
+}
+
+const char* SynthEngine::stageName(uint8_t stage) {
+  return stage < SYNTH_STAGE_COUNT ? kStageNames[stage] : "";
+}
 
-  if (testToneActive_ && (int32_t)(nowMs - testToneEndMs_) >= 0) {
-    noteOff(testNotes_[0]);
-    noteOff(testNotes_[1]);
-    noteOff(testNotes_[2]);
-    testToneActive_ = false;
+uint32_t SynthEngine::recordBlockStats() {
+  uint32_t render = 0;
+  for (uint8_t s = 0; s < SYNTH_STAGE_I2S_WAIT; ++s) render += blockCycles_[s];
+
+  uint32_t bin = static_cast<uint32_t>((static_cast<uint64_t>(render) * 10u) / deadlineCycles_);
+  if (bin >= SynthStats::kHistBins) bin = SynthStats::kHistBins - 1;
+
+  statsLock_.enter();
+  for (uint8_t s = 0; s <= SYNTH_STAGE_COUNT; ++s) {
+    const uint32_t c = s < SYNTH_STAGE_COUNT ? blockCycles_[s] : render;
+    StageAccum& a = stageAccum_[s];
+    if (c < a.minCycles) a.minCycles = c;
+    if (c > a.maxCycles) a.maxCycles = c;
+    a.sumCycles += c;
   }
+  statBlocks_++;
+  if (render > deadlineCycles_) statOverruns_++;
+  loadHist_[bin]++;
+  statsLock_.exit();
+  return render;
 }
 
-uint32_t SynthEngine::consumeUnderruns() {
-  portENTER_CRITICAL(&eventMux_);
-  uint32_t v = underruns_;
-  underruns_ = 0;
-  portEXIT_CRITICAL(&eventMux_);
-  return v;
+void SynthEngine::setLoadGovernor(bool enabled, uint8_t highPct, uint8_t lowPct) {
+  const uint8_t high = highPct < 1 ? 1 : highPct;
+  const uint8_t low = lowPct < high ? lowPct : high - 1;
+  govThresholds_.store(static_cast<uint16_t>((high << 8) | low), std::memory_order_relaxed);
+  govEnabled_.store(enabled, std::memory_order_relaxed);
+  // Dropping the governor also drops whatever it is currently holding back.
+  // The audio task does that at its next block: a step it takes after this
+  // store is still undone, and the drum voices are never walked mid-render.
+  if (!enabled) govResetPending_.store(true, std::memory_order_release);
 }
 
-void SynthEngine::noteOn(uint8_t note, uint8_t vel, uint16_t gateMs) {
-  pushEvent(EVT_NOTE_ON, note, vel);
+void SynthEngine::resetGovernor() {
+  govLoadAvg_ = 0.0f;
+  govCooldown_ = 0;
+  govCalmBlocks_ = 0;
+  voiceCap_ = kMaxVoices;
+  fxLite_ = false;
+  govDrumPartCycles_ = 0.0f;
+  govDrumHold_ = 0;
+  drum_.setMaxParts(DrumEngine::kPartCount);
+}
+
+bool SynthEngine::shedQuietestReleasing() {
+  // pickVictim() ranks releasing voices first, so a held victim means none are releasing.
+  const uint8_t idx = pickVictim(voices_.activeMask & ~voices_.dyingMask);
+  if (idx == kNoVoice || !voiceReleasing(idx)) return false;
+  fadeOutVoice(idx);
+  return true;
+}
 
-  if (gateMs == 0) return;
-  uint32_t at = millis() + gateMs;
-  for (auto& s : offSched_) {
-    if (s.active && s.note == note) {
-      s.atMs = at;
+// Sizes the drum part cap from the measured cost per sounding part-frame so
+// a full cap fits kDrumBudgetPct of the deadline, fading parts already over
+// it. True while drums have played within about the last second and so hold
+// their reservation.
+bool SynthEngine::budgetDrums(uint32_t drumCycles) {
+  const uint32_t partFrames = drum_.takePartFrames();
+  if (partFrames == 0) {
+    if (govDrumHold_ > 0) govDrumHold_--;
+    return govDrumHold_ > 0;
+  }
+  const float perFrame = static_cast<float>(drumCycles) / static_cast<float>(partFrames);
+  if (govDrumPartCycles_ <= 0.0f) govDrumPartCycles_ = perFrame;
+  govDrumPartCycles_ += (perFrame - govDrumPartCycles_) * 0.125f;
+  govDrumHold_ = static_cast<uint16_t>(sampleRate_ / blockSize_);
+
+  const float budget = static_cast<float>(deadlineCycles_) * kDrumBudgetPct * 0.01f;
+  const float fit = budget / (govDrumPartCycles_ * static_cast<float>(blockSize_));
+  const uint8_t cuts =
+      drum_.setMaxParts(fit >= DrumEngine::kPartCount ? DrumEngine::kPartCount : static_cast<uint8_t>(fit));
+  if (cuts > 0) {
+    statsLock_.enter();
+    govDrumCuts_ += cuts;
+    statsLock_.exit();
+  }
+  return true;
+}
+
+void SynthEngine::governLoad(uint32_t renderCycles) {
+  if (govResetPending_.exchange(false, std::memory_order_acquire)) resetGovernor();
+  if (!govEnabled_.load(std::memory_order_relaxed)) return;
+  const uint16_t thresholds = govThresholds_.load(std::memory_order_relaxed);
+  const uint8_t highPct = static_cast<uint8_t>(thresholds >> 8);
+  const uint8_t lowPct = static_cast<uint8_t>(thresholds);
+
+  // The drum share is budgeted apart; the synth answers for the rest.
+  const uint32_t drumCycles = blockCycles_[SYNTH_STAGE_DRUMS];
+  const uint8_t reserve = budgetDrums(drumCycles) && lowPct > kDrumBudgetPct ? kDrumBudgetPct : 0;
+  if (reserve > 0) renderCycles -= drumCycles < renderCycles ? drumCycles : renderCycles;
+
+  const float load = static_cast<float>(renderCycles) / static_cast<float>(deadlineCycles_);
+  govLoadAvg_ += (load - govLoadAvg_) * 0.125f;
+  const float high = static_cast<float>(highPct - reserve) * 0.01f;
+  const float low = static_cast<float>(lowPct - reserve) * 0.01f;
+  if (govCooldown_ > 0) govCooldown_--;
+
+  if (load > high || govLoadAvg_ > high) {
+    govCalmBlocks_ = 0;
+    if (govCooldown_ > 0) return;
+    govCooldown_ = kGovCooldownBlocks;
+
+    // Cheapest audible cost first: tails nobody hears, then reverb detail, then notes.
+    if (!govMono_ && shedQuietestReleasing()) {
+      statsLock_.enter();
+      govShed_++;
+      statsLock_.exit();
       return;
     }
-  }
-  for (auto& s : offSched_) {
-    if (!s.active) {
-      s.active = true;
-      s.note = note;
-      s.atMs = at;
+    if (!fxLite_) {
+      fxLite_ = true;
+      statsLock_.enter();
+      govFxLiteSteps_++;
+      statsLock_.exit();
       return;
     }
+    const uint8_t sounding = liveVoiceCount();
+    uint8_t cap = voiceCap_ < sounding ? voiceCap_ : sounding;
+    if (cap > kGovMinVoices) {
+      voiceCap_ = cap - 1;
+      statsLock_.enter();
+      govCapSteps_++;
+      statsLock_.exit();
+    }
+    return;
+  }
+
+  if (govLoadAvg_ >= low) {
+    govCalmBlocks_ = 0;
+    return;
+  }
+
+  // Restore one step per second of calm, in reverse order of degradation.
+  if (++govCalmBlocks_ < sampleRate_ / blockSize_) return;
+  govCalmBlocks_ = 0;
+  if (voiceCap_ < kMaxVoices) {
+    voiceCap_ = voiceCap_ + 1 >= govPatchVoices_ ? kMaxVoices : voiceCap_ + 1;
+  } else if (fxLite_) {
+    fxLite_ = false;
+  } else {
+    return;
+  }
+  statsLock_.enter();
+  govRestoreSteps_++;
+  statsLock_.exit();
+}
+
+uint32_t SynthEngine::sampleTimeAt(uint32_t us) const {
+  const uint32_t latency = static_cast<uint32_t>(blockSize_) * kStampLatencyBlocks;
+  if (!running_) return sampleClock();
+  // A few tries at most: the audio task may be preempted mid-publish.
+  for (uint8_t tries = 0; tries < 4; ++tries) {
+    const uint32_t seq = anchorSeq_.load(std::memory_order_acquire);
+    const uint32_t sample = anchorSample_.load(std::memory_order_relaxed);
+    const uint32_t base = anchorUs_.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if ((seq & 1u) || seq != anchorSeq_.load(std::memory_order_relaxed)) continue;
+    const int32_t elapsedUs = static_cast<int32_t>(us - base);
+    const int64_t elapsed = (static_cast<int64_t>(elapsedUs) * sampleRate_) / 1000000;
+    return sample + static_cast<uint32_t>(static_cast<int32_t>(elapsed)) + latency;
   }
-  offSched_[0].active = true;
-  offSched_[0].note = note;
-  offSched_[0].atMs = at;
+  return sampleClock() + latency;
+}
+
+uint32_t SynthEngine::sampleTimeNow() const {
+  return sampleTimeAt(micros());
+}
+
+// Audio task only (or before it starts): ties the next block's first sample to `us`.
+void SynthEngine::publishClockAnchor(uint32_t us) {
+  const uint32_t seq = anchorSeq_.load(std::memory_order_relaxed);
+  anchorSeq_.store(seq + 1u, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  anchorSample_.store(blockClock_, std::memory_order_relaxed);
+  anchorUs_.store(us, std::memory_order_relaxed);
+  anchorSeq_.store(seq + 2u, std::memory_order_release);
+}
+
+void SynthEngine::noteOn(uint8_t note, uint8_t vel, uint16_t gateMs) {
+  noteOnAt(sampleTimeNow(), note, vel, gateMs);
+}
+
+// Notes are masked to 7 bits here, once: the audio task indexes per-note
+// tables with them unchecked.
+void SynthEngine::noteOnAt(uint32_t at, uint8_t note, uint8_t vel, uint16_t gateMs) {
+  pushEvent(at, EVT_NOTE_ON, note & 0x7F, vel, gateMs == 0 ? 0 : msToSamples(gateMs));
+}
+
+// At least one sample, so a gate never reads as "none".
+uint32_t SynthEngine::msToSamples(uint32_t ms) const {
+  const uint64_t samples = (static_cast<uint64_t>(ms) * sampleRate_) / 1000u;
+  return samples == 0 ? 1u : (samples > 0x7FFFFFFFu ? 0x7FFFFFFFu : static_cast<uint32_t>(samples));
 }
 
 void SynthEngine::noteOff(uint8_t note) {
-  pushEvent(EVT_NOTE_OFF, note, 0);
+  noteOffAt(sampleTimeNow(), note);
+}
+
+void SynthEngine::noteOffAt(uint32_t at, uint8_t note) {
+  pushEvent(at, EVT_NOTE_OFF, note & 0x7F, 0);
 }
 
 void SynthEngine::allNotesOff() {
-  memset(offSched_, 0, sizeof(offSched_));
-  pushEvent(EVT_ALL_NOTES_OFF, 0, 0);
+  pushEvent(sampleTimeNow(), EVT_ALL_NOTES_OFF, 0, 0);
 }
 
 void SynthEngine::drumHit(uint8_t part, uint8_t vel) {
+  drumHitAt(sampleTimeNow(), part, vel);
+}
+
+void SynthEngine::drumHitAt(uint32_t at, uint8_t part, uint8_t vel) {
   if (!drumsEnabled_) return;
-  pushEvent(EVT_DRUM_HIT, part, vel);
+  pushEvent(at, EVT_DRUM_HIT, part, vel);
 }
 
 void SynthEngine::allDrumsOff() {
-  pushEvent(EVT_ALL_DRUMS_OFF, 0, 0);
+  pushEvent(sampleTimeNow(), EVT_ALL_DRUMS_OFF, 0, 0);
 }
 
 void SynthEngine::setDrumsEnabled(bool enabled) {
@@ -723,114 +894,400 @@ void SynthEngine::setDrumsEnabled(bool enabled) {
   if (!enabled) allDrumsOff();
 }
 
-bool SynthEngine::pushEvent(uint8_t type, uint8_t a, uint8_t b) {
-  bool ok = false;
-  portENTER_CRITICAL(&eventMux_);
-  const uint8_t next = static_cast<uint8_t>((eventHead_ + 1u) % kEventQueueSize);
-  if (next != eventTail_) {
-    eventQueue_[eventHead_].type = type;
-    eventQueue_[eventHead_].a = a;
-    eventQueue_[eventHead_].b = b;
-    eventHead_ = next;
-    ok = true;
+bool SynthEngine::openDrumSamples(const char* name) {
+  if (running_) return false;
+  return drum_.openSamples(name);
+}
+
+bool SynthEngine::storeDrumKit(uint8_t slot, const DrumKitDef& kit) {
+  if (!drum_.storeKit(slot, kit)) return false;
+  // The audio task re-derives the selected kit, whichever it is.
+  paramDirty_.fetch_or(1u << SYNTH_PARAM_DRUM_KIT, std::memory_order_release);
+  return true;
+}
+
+// Control task only. Note-ons and drum hits leave kEventReserve slots free
+// and are dropped (and counted) beyond that; note-offs and all-offs are never
+// lost: with the ring full they are parked for the audio task to pick up.
+bool SynthEngine::pushEvent(uint32_t at, uint8_t type, uint8_t a, uint8_t b, uint32_t gate) {
+  // The audio task consumes in push order, so a stamp never runs behind the
+  // previous one; nor does the floor trail the clock, so it cannot wrap.
+  const uint32_t clock = sampleClock();
+  if (static_cast<int32_t>(lastStamp_ - clock) < 0) lastStamp_ = clock;
+  if (static_cast<int32_t>(at - lastStamp_) < 0) at = lastStamp_;
+  lastStamp_ = at;
+
+  Event e;
+  e.at = at;
+  e.gate = type == EVT_NOTE_ON ? gate : 0;
+  e.type = type;
+  e.a = a;
+  e.b = b;
+
+  if (type == EVT_NOTE_ON) {
+    // The retrigger supersedes a parked note-off, which must not land after it.
+    std::atomic<uint32_t>& word = parkedOffs_[(a >> 5) & 3u];
+    const uint32_t bit = 1u << (a & 31u);
+    if (word.load(std::memory_order_relaxed) & bit) word.fetch_and(~bit, std::memory_order_relaxed);
+  }
+
+  const bool mustDeliver = type == EVT_NOTE_OFF || type == EVT_ALL_NOTES_OFF || type == EVT_ALL_DRUMS_OFF;
+  if (events_.push(e, mustDeliver ? 0 : kEventReserve)) return true;
+
+  switch (type) {
+    case EVT_NOTE_OFF:
+      // Repeated offs for one note coalesce into the same bit. The index goes
+      // first so the audio task never sees the bit without it.
+      parkedOffsBefore_.store(events_.pushIndex() + 1u, std::memory_order_release);
+      parkedOffs_[(a >> 5) & 3u].fetch_or(1u << (a & 31u), std::memory_order_release);
+      offsParked_.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    case EVT_ALL_NOTES_OFF:
+      parkedAllNotesOff_.store(events_.pushIndex() + 1u, std::memory_order_release);
+      return true;
+    case EVT_ALL_DRUMS_OFF:
+      parkedAllDrumsOff_.store(events_.pushIndex() + 1u, std::memory_order_release);
+      return true;
+    default:
+      eventsDropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
   }
-  portEXIT_CRITICAL(&eventMux_);
-  return ok;
 }
 
-bool SynthEngine::popEvent(Event& out) {
-  bool ok = false;
-  portENTER_CRITICAL(&eventMux_);
-  if (eventTail_ != eventHead_) {
-    out = eventQueue_[eventTail_];
-    eventTail_ = static_cast<uint8_t>((eventTail_ + 1u) % kEventQueueSize);
-    ok = true;
+// Applies parked all-offs that were pushed before the event at beforeIndex.
+void SynthEngine::applyParkedAllOffs(uint32_t beforeIndex, const SynthParams& p) {
+  std::atomic<uint32_t>* parked[2] = {&parkedAllNotesOff_, &parkedAllDrumsOff_};
+  const uint8_t types[2] = {EVT_ALL_NOTES_OFF, EVT_ALL_DRUMS_OFF};
+  for (uint8_t k = 0; k < 2; ++k) {
+    uint32_t at = parked[k]->load(std::memory_order_acquire);
+    if (at == 0 || static_cast<int32_t>(beforeIndex - (at - 1u)) < 0) continue;
+    if (!parked[k]->compare_exchange_strong(at, 0, std::memory_order_acquire)) continue;
+    Event e;
+    e.at = 0;
+    e.gate = 0;
+    e.type = types[k];
+    e.a = 0;
+    e.b = 0;
+    handleEvent(e, p);
   }
-  portEXIT_CRITICAL(&eventMux_);
-  return ok;
+}
+
+// Applies parked note-offs once every event pushed before the latest of them
+// has been consumed. Bits parked after they were taken wait for the next round,
+// so one shared index always covers the whole held set.
+void SynthEngine::applyParkedOffs(uint32_t beforeIndex, const SynthParams& p) {
+  if (heldOffsBefore_ == 0) {
+    uint32_t any = 0;
+    for (uint8_t w = 0; w < 4; ++w) any |= parkedOffs_[w].load(std::memory_order_relaxed);
+    if (any == 0) return;
+    for (uint8_t w = 0; w < 4; ++w) heldOffs_[w] = parkedOffs_[w].exchange(0, std::memory_order_acquire);
+    heldOffsBefore_ = parkedOffsBefore_.load(std::memory_order_acquire);
+  }
+  if (static_cast<int32_t>(beforeIndex - (heldOffsBefore_ - 1u)) < 0) return;
+
+  for (uint8_t w = 0; w < 4; ++w) {
+    for (uint32_t bits = heldOffs_[w]; bits; bits &= bits - 1) {
+      Event off;
+      off.at = 0;
+      off.gate = 0;
+      off.type = EVT_NOTE_OFF;
+      off.a = static_cast<uint8_t>(w * 32u + lowestBit(bits));
+      off.b = 0;
+      handleEvent(off, p);
+    }
+    heldOffs_[w] = 0;
+  }
+  heldOffsBefore_ = 0;
+}
+
+void SynthEngine::applyParked(uint32_t beforeIndex, const SynthParams& p) {
+  applyParkedAllOffs(beforeIndex, p);
+  applyParkedOffs(beforeIndex, p);
+}
+
+// Audio task only. Events leave the ring in push order, which is stamp order;
+// the first one stamped past `offset` stays queued and ends the slice there,
+// as does the next gate deadline.
+uint16_t SynthEngine::applyDueEvents(const SynthParams& p, uint16_t offset, uint16_t n) {
+  const uint32_t now = blockClock_ + offset;
+  // Gates closing on this sample go before its events, so a note-on here retriggers cleanly.
+  uint8_t note = 0;
+  uint32_t deadline = 0;
+  while (gates_.top(note, deadline) && static_cast<int32_t>(deadline - now) <= 0) {
+    gates_.pop();
+    Event off;
+    off.at = deadline;
+    off.gate = 0;
+    off.type = EVT_NOTE_OFF;
+    off.a = note;
+    off.b = 0;
+    handleEvent(off, p);
+  }
+
+  uint32_t next = blockClock_ + n;
+  Event e;
+  uint32_t index = 0;
+  bool waiting = false;
+  while (events_.peek(e, index)) {
+    applyParked(index, p);
+    if (static_cast<int32_t>(e.at - now) > 0) {
+      if (static_cast<int32_t>(e.at - next) < 0) next = e.at;
+      waiting = true;
+      break;
+    }
+    handleEvent(e, p);
+    // Late events start now, and so does their gate.
+    if (e.type == EVT_NOTE_ON && e.gate != 0) gates_.set(e.a, now + e.gate);
+    events_.drop();
+  }
+  if (!waiting) applyParked(events_.popIndex(), p);
+
+  if (gates_.top(note, deadline) && static_cast<int32_t>(deadline - next) < 0) next = deadline;
+  return static_cast<uint16_t>(offset + (next - now));
 }
 
 void SynthEngine::taskTrampoline(void* arg) {
   SynthEngine* self = static_cast<SynthEngine*>(arg);
   if (self) self->audioTask();
-  vTaskDelete(nullptr);
-}
-
-SynthEngine::Voice* SynthEngine::allocVoice(uint8_t note, bool monoMode) {
-  if (monoMode) {
-    Voice& v = voices_[0];
-    v.active = true;
-    v.note = note;
-    v.age = ++voiceAgeCounter_;
-    v.phaseA = 0.0f;
-    v.phaseB = 0.0f;
-    return &v;
-  }
-
-  for (auto& v : voices_) {
-    if (!v.active) {
-      v.active = true;
-      v.note = note;
-      v.age = ++voiceAgeCounter_;
-      v.phaseA = 0.0f;
-      v.phaseB = 0.0f;
-      return &v;
+  platform::endCurrentTask();
+}
+
+void SynthEngine::workerTrampoline(void* arg) {
+  SynthEngine* self = static_cast<SynthEngine*>(arg);
+  if (self) self->workerTask();
+  platform::endCurrentTask();
+}
+
+// Control task only.
+void SynthEngine::setParallel(bool enabled) {
+  if (enabled == workerAlive_) return;
+  if (enabled) {
+    workerRun_ = true;
+    workerAlive_ = true;
+    // Above the core-0 control task in real-time mode; it sleeps between jobs.
+    const uint8_t priority = realtime_ ? platform::kRealtimePriority : 1;
+    if (!platform::startTask(workerTrampoline, "beca_voices", 4096, this, priority, 0)) {
+      workerRun_ = false;
+      workerAlive_ = false;
+    }
+    return;
+  }
+  workerRun_ = false;
+  jobReady_.post();
+  const uint32_t t0 = millis();
+  while (workerAlive_ && (millis() - t0) < 500) {
+    delay(2);
+  }
+}
+
+void SynthEngine::workerTask() {
+  while (workerRun_) {
+    if (!jobReady_.wait(20)) continue;
+    // A stale wake-up, or the audio task already took the job back.
+    uint8_t expected = JOB_POSTED;
+    if (!jobState_.compare_exchange_strong(expected, JOB_RUNNING, std::memory_order_acquire)) continue;
+    const VoiceJob& j = job_;
+    memset(workerCount_, 0, j.n);
+    if (fixedPoint_) {
+      memset(workerBusQ_, 0, sizeof(int32_t) * j.n);
+      job_.ended = renderVoiceSetQ(*j.p, j.mask, workerBusQ_, workerCount_, workerEnvQ_, j.n);
+    } else {
+      memset(workerBus_, 0, sizeof(float) * j.n);
+      job_.ended = renderVoiceSet(*j.p, j.mask, workerBus_, workerCount_, workerEnv_, j.n);
+    }
+    jobState_.store(JOB_DONE, std::memory_order_release);
+  }
+  workerAlive_ = false;
+}
+
+// Hands every other active voice to the worker and returns them, or 0 when the
+// slice stays on this core. Alternating keeps both halves a similar mix of
+// attacks and releases.
+uint32_t SynthEngine::postVoiceJob(const SynthParams& p, uint16_t n) {
+  const uint32_t active = voices_.activeMask;
+  if (!workerAlive_ || n < kParallelMinFrames || voiceCount(active) < kParallelMinVoices) return 0;
+  uint32_t split = 0;
+  bool take = false;
+  for (uint32_t m = active; m; m &= m - 1) {
+    if (take) split |= 1u << lowestBit(m);
+    take = !take;
+  }
+  job_.p = &p;
+  job_.mask = split;
+  job_.ended = 0;
+  job_.n = n;
+  jobState_.store(JOB_POSTED, std::memory_order_release);
+  jobReady_.post();
+  ++parallelSlices_;
+  return split;
+}
+
+// True once the worker has rendered the job into its bus; false when it had
+// not started, in which case the job is cancelled and the caller renders it.
+bool SynthEngine::joinVoiceJob() {
+  uint8_t expected = JOB_POSTED;
+  if (jobState_.compare_exchange_strong(expected, JOB_IDLE, std::memory_order_acquire)) {
+    ++parallelReclaims_;
+    return false;
+  }
+  while (jobState_.load(std::memory_order_acquire) != JOB_DONE) platform::yieldTask();
+  jobState_.store(JOB_IDLE, std::memory_order_relaxed);
+  return true;
+}
+
+void SynthEngine::resetVoice(uint8_t idx) {
+  voices_.note[idx] = 0;
+  voices_.age[idx] = 0;
+  voices_.phaseA[idx] = 0;
+  voices_.phaseB[idx] = 0;
+  voices_.vel[idx] = 0.0f;
+  voices_.env[idx].reset();
+  voices_.envQ[idx].reset();
+}
+
+uint8_t SynthEngine::allocVoice(uint8_t note, const SynthParams& p) {
+  VoiceBank& vb = voices_;
+  uint8_t idx;
+  if (p.mono) {
+    // Mono always plays voice 0; anything else still sounding is dropped.
+    idx = 0;
+    for (uint32_t m = vb.activeMask & ~1u; m; m &= m - 1) freeVoice(lowestBit(m));
+    if ((vb.activeMask & 1u) && vb.noteVoice[vb.note[0]] == 0) vb.noteVoice[vb.note[0]] = kNoVoice;
+  } else {
+    // A note that is still sounding, held or releasing, retriggers its own voice.
+    idx = vb.noteVoice[note];
+    if (idx == kNoVoice) {
+      const uint32_t live = vb.activeMask & ~vb.dyingMask;
+      if (voiceCount(live) >= p.maxVoices) fadeOutVoice(pickVictim(live));
+      const uint32_t freeMask = ~vb.activeMask & kAllVoices;
+      if (freeMask) {
+        idx = lowestBit(freeMask);
+      } else {
+        // Every voice is busy or fading: take the best victim over outright.
+        idx = pickVictim(vb.activeMask);
+        freeVoice(idx);
+      }
     }
   }
 
-  Voice* oldest = &voices_[0];
-  for (auto& v : voices_) {
-    if (v.age < oldest->age) oldest = &v;
+  const uint32_t bit = 1u << idx;
+  if (!(vb.activeMask & bit)) {
+    vb.phaseA[idx] = 0;
+    vb.phaseB[idx] = 0;
+    vb.env[idx].reset();
+    vb.envQ[idx].reset();
   }
-  oldest->active = true;
-  oldest->note = note;
-  oldest->age = ++voiceAgeCounter_;
-  oldest->phaseA = 0.0f;
-  oldest->phaseB = 0.0f;
-  return oldest;
+  vb.activeMask |= bit;
+  vb.dyingMask &= ~bit;
+  vb.note[idx] = note;
+  vb.age[idx] = ++voiceAgeCounter_;
+  vb.noteVoice[note] = idx;
+  return idx;
+}
+
+void SynthEngine::freeVoices(uint32_t mask) {
+  for (uint32_t m = mask; m; m &= m - 1) freeVoice(lowestBit(m));
 }
 
-float SynthEngine::osc(uint8_t waveform, float phase) const {
-  switch (waveform) {
-    case 0:  // saw
-      return 2.0f * phase - 1.0f;
-    case 1:  // square
-      return phase < 0.5f ? 1.0f : -1.0f;
-    case 2: {  // triangle
-      float t = fabsf(2.0f * phase - 1.0f);
-      return 1.0f - 2.0f * t;
+void SynthEngine::freeVoice(uint8_t idx) {
+  const uint32_t bit = 1u << idx;
+  if (voices_.noteVoice[voices_.note[idx]] == idx) voices_.noteVoice[voices_.note[idx]] = kNoVoice;
+  voices_.activeMask &= ~bit;
+  voices_.dyingMask &= ~bit;
+}
+
+void SynthEngine::fadeOutVoice(uint8_t idx) {
+  if (idx == kNoVoice) return;
+  if (voices_.noteVoice[voices_.note[idx]] == idx) voices_.noteVoice[voices_.note[idx]] = kNoVoice;
+  voices_.dyingMask |= 1u << idx;
+  voices_.env[idx].quickRelease(kStealFadeSec);
+  voices_.envQ[idx].quickRelease(kStealFadeSec);
+}
+
+bool SynthEngine::voiceReleasing(uint8_t idx) const {
+  return fixedPoint_ ? voices_.envQ[idx].releasing() : voices_.env[idx].releasing();
+}
+
+float SynthEngine::voiceLevel(uint8_t idx) const {
+  const float env = fixedPoint_ ? static_cast<float>(voices_.envQ[idx].level()) / static_cast<float>(dsp::kQ31One)
+                                : voices_.env[idx].level();
+  return env * voices_.vel[idx];
+}
+
+// Steal order: releasing voices before held ones, then the quietest, then the oldest.
+uint8_t SynthEngine::pickVictim(uint32_t candidates) const {
+  uint8_t best = kNoVoice;
+  bool bestReleasing = false;
+  float bestLevel = 0.0f;
+  for (uint32_t m = candidates; m; m &= m - 1) {
+    const uint8_t i = lowestBit(m);
+    const bool releasing = voiceReleasing(i);
+    const float level = voiceLevel(i);
+    bool better = best == kNoVoice || (releasing && !bestReleasing);
+    if (!better && releasing == bestReleasing) {
+      better = level < bestLevel || (level == bestLevel && voices_.age[i] < voices_.age[best]);
+    }
+    if (better) {
+      best = i;
+      bestReleasing = releasing;
+      bestLevel = level;
     }
-    case 3:
-    default:
-      return sinf(2.0f * dsp::kPi * phase);
   }
+  return best;
+}
+
+// Fades out the lowest-priority voices until at most maxVoices are left sounding.
+void SynthEngine::enforceVoiceLimit(uint8_t maxVoices) {
+  uint32_t live = voices_.activeMask & ~voices_.dyingMask;
+  while (voiceCount(live) > maxVoices) {
+    const uint8_t idx = pickVictim(live);
+    fadeOutVoice(idx);
+    live &= ~(1u << idx);
+  }
+}
+
+uint8_t SynthEngine::liveVoiceCount() const {
+  return voiceCount(voices_.activeMask & ~voices_.dyingMask);
 }
 
 void SynthEngine::handleEvent(const Event& e, const SynthParams& p) {
   switch (e.type) {
     case EVT_NOTE_ON: {
-      Voice* v = allocVoice(e.a, p.mono != 0);
-      if (!v) break;
-      v->vel = dsp::clampf(static_cast<float>(e.b) / 127.0f, 0.05f, 1.0f);
-      v->env.setSampleRate(static_cast<float>(sampleRate_));
-      v->env.set(p.attack, p.decay, p.sustain, p.release);
-      v->env.noteOn();
-      if (p.mono) {
-        for (uint8_t i = 1; i < kMaxVoices; ++i) voices_[i].active = false;
-      }
+      // A gated note-on sets its gate after this; an ungated one holds until its off.
+      gates_.cancel(e.a);
+      const uint8_t v = allocVoice(e.a, p);
+      if (v == kNoVoice) break;
+      voices_.vel[v] = dsp::clampf(static_cast<float>(e.b) / 127.0f, 0.05f, 1.0f);
+      voices_.env[v].setSampleRate(static_cast<float>(sampleRate_));
+      voices_.env[v].setCurve(p.envCurve);
+      voices_.env[v].set(p.attack, p.decay, p.sustain, p.release);
+      voices_.env[v].noteOn();
+      voices_.envQ[v].setSampleRate(static_cast<float>(sampleRate_));
+      voices_.envQ[v].set(p.attack, p.decay, p.sustain, p.release);
+      voices_.envQ[v].noteOn();
     } break;
-    case EVT_NOTE_OFF:
-      for (auto& v : voices_) {
-        if (v.active && v.note == e.a) v.env.noteOff();
+    case EVT_NOTE_OFF: {
+      gates_.cancel(e.a);
+      const uint8_t v = voices_.noteVoice[e.a];
+      if (v != kNoVoice) {
+        voices_.env[v].noteOff();
+        voices_.envQ[v].noteOff();
       }
-      break;
+    } break;
     case EVT_ALL_NOTES_OFF:
-      for (auto& v : voices_) {
-        if (v.active) v.env.noteOff();
+      gates_.clear();
+      for (uint32_t m = voices_.activeMask & ~voices_.dyingMask; m; m &= m - 1) {
+        const uint8_t i = lowestBit(m);
+        voices_.env[i].noteOff();
+        voices_.envQ[i].noteOff();
       }
       break;
     case EVT_DRUM_HIT:
-      if (drumsEnabled_) drum_.trigger(e.a, e.b);
+      if (drumsEnabled_ && drum_.trigger(e.a, e.b)) {
+        statsLock_.enter();
+        govDrumCuts_++;
+        statsLock_.exit();
+      }
       break;
     case EVT_ALL_DRUMS_OFF:
       drum_.allOff();
@@ -841,134 +1298,331 @@ void SynthEngine::handleEvent(const Event& e, const SynthParams& p) {
 }
 
 void SynthEngine::applyFilterConfig(const SynthParams& p) {
-  if (!filterDirty_ &&
-      lastFilterType_ == p.filterType &&
-      fabsf(lastCutoffHz_ - p.cutoffHz) < 0.5f &&
-      fabsf(lastResonance_ - p.resonance) < 0.01f) {
+  // Cutoff glides in table position (about log frequency) and resonance
+  // linearly, one step per block; a type change or reset jumps straight there.
+  const float targetPos = filterTable_.position(p.cutoffHz);
+  const float targetRes = dsp::clampf(p.resonance, 0.1f, 10.0f);
+  if (filterDirty_ || lastFilterType_ != p.filterType) {
+    filterPos_ = targetPos;
+    filterRes_ = targetRes;
+  } else if (filterPos_ == targetPos && filterRes_ == targetRes) {
     return;
+  } else {
+    filterPos_ += (targetPos - filterPos_) * filterGlide_;
+    filterRes_ += (targetRes - filterRes_) * filterGlide_;
+    if (fabsf(targetPos - filterPos_) < 0.01f) filterPos_ = targetPos;
+    if (fabsf(targetRes - filterRes_) < 0.001f) filterRes_ = targetRes;
   }
 
-  switch (p.filterType) {
-    case SYNTH_FILTER_LOWPASS:
-      filterL_.setLowpass(static_cast<float>(sampleRate_), p.cutoffHz, p.resonance);
-      filterR_.setLowpass(static_cast<float>(sampleRate_), p.cutoffHz, p.resonance);
-      break;
-    case SYNTH_FILTER_HIGHPASS:
-      filterL_.setHighpass(static_cast<float>(sampleRate_), p.cutoffHz, p.resonance);
-      filterR_.setHighpass(static_cast<float>(sampleRate_), p.cutoffHz, p.resonance);
-      break;
-    case SYNTH_FILTER_BANDPASS:
-    default:
-      filterL_.setBandpass(static_cast<float>(sampleRate_), p.cutoffHz, p.resonance);
-      filterR_.setBandpass(static_cast<float>(sampleRate_), p.cutoffHz, p.resonance);
-      break;
-  }
+  float c = 1.0f;
+  float s = 0.0f;
+  filterTable_.lookup(filterPos_, c, s);
+  filter_.setShape(p.filterType, c, s, filterRes_);
+  filterQ_.setFrom(filter_);
   lastFilterType_ = p.filterType;
-  lastCutoffHz_ = p.cutoffHz;
-  lastResonance_ = p.resonance;
   filterDirty_ = false;
 }
 
-void SynthEngine::renderBlock(const SynthParams& p) {
-  applyFilterConfig(p);
+template <bool Mono>
+void SynthEngine::renderVoices(const SynthParams& p, uint16_t offset, uint16_t n) {
+  float* bus = synthBus_ + offset;
+  uint8_t* count = voiceCount_ + offset;
+  memset(bus, 0, sizeof(float) * n);
+  memset(count, 0, n);
 
-  const uint32_t delaySamples = static_cast<uint32_t>(
-      constrain(static_cast<int>((p.delayMs * static_cast<float>(sampleRate_)) / 1000.0f), 1, static_cast<int>(kMaxDelaySamples - 1)));
-
-  Voice* activeList[kMaxVoices];
-  float incA[kMaxVoices];
-  float incB[kMaxVoices];
-  uint8_t activeTarget = 0;
-  for (uint8_t vIdx = 0; vIdx < kMaxVoices; ++vIdx) {
-    Voice& v = voices_[vIdx];
-    if (!v.active) continue;
-    if (activeTarget >= p.maxVoices) {
-      v.env.noteOff();
-      continue;
+  if (Mono) {
+    for (uint32_t m = voices_.activeMask & ~1u; m; m &= m - 1) freeVoice(lowestBit(m));
+  }
+  const uint32_t split = postVoiceJob(p, n);
+  uint32_t ended = renderVoiceSet(p, voices_.activeMask & ~split, bus, count, envBuf_, n);
+  if (split) {
+    if (joinVoiceJob()) {
+      for (uint16_t i = 0; i < n; ++i) {
+        bus[i] += workerBus_[i];
+        count[i] += workerCount_[i];
+      }
+      ended |= job_.ended;
+    } else {
+      ended |= renderVoiceSet(p, split, bus, count, envBuf_, n);
     }
+  }
+  freeVoices(ended);
+}
 
-    const float noteHz = dsp::midiToHz(v.note);
-    const float lowNoteScale = dsp::clampf((static_cast<float>(v.note) - 24.0f) / 60.0f, 0.35f, 1.0f);
+uint32_t SynthEngine::renderVoiceSet(const SynthParams& p, uint32_t mask, float* bus, uint8_t* count, float* env,
+                                     uint16_t n) {
+  const float mixA = 1.0f - p.oscMix;
+  const float mixB = p.oscMix;
+  uint32_t ended = 0;
+  for (uint32_t m = mask; m; m &= m - 1) {
+    const uint8_t vi = lowestBit(m);
+
+    const uint8_t note = voices_.note[vi];
+    const float noteHz = dsp::midiToHz(note);
+    const float lowNoteScale = dsp::clampf((static_cast<float>(note) - 24.0f) / 60.0f, 0.35f, 1.0f);
     const float detune = p.detuneCents * lowNoteScale;
     const float detuneRatio = powf(2.0f, detune / 1200.0f);
+    const uint32_t incA = dsp::phaseIncrement(noteHz, static_cast<float>(sampleRate_));
+    const uint32_t incB = dsp::phaseIncrement(noteHz * detuneRatio, static_cast<float>(sampleRate_));
+    // Mip level is chosen once per block from the voice pitch.
+    const int16_t* tableA = dsp::wavetable(p.waveA, incA);
+    const int16_t* tableB = dsp::wavetable(p.waveB, incB);
+    const float vel = voices_.vel[vi];
+    uint32_t phaseA = voices_.phaseA[vi];
+    uint32_t phaseB = voices_.phaseB[vi];
+
+    const uint16_t live = voices_.env[vi].processBlock(env, n);
+    if (live < n) ended |= 1u << vi;
+
+    for (uint16_t i = 0; i < live; ++i) {
+      count[i]++;
+
+      phaseA += incA;
+      phaseB += incB;
+
+      const float a = dsp::wavetableRead(tableA, phaseA);
+      const float b = dsp::wavetableRead(tableB, phaseB);
+      bus[i] += (mixA * a + mixB * b) * env[i] * vel;
+    }
 
-    activeList[activeTarget] = &v;
-    incA[activeTarget] = noteHz / static_cast<float>(sampleRate_);
-    incB[activeTarget] = (noteHz * detuneRatio) / static_cast<float>(sampleRate_);
-    activeTarget++;
+    voices_.phaseA[vi] = phaseA;
+    voices_.phaseB[vi] = phaseB;
   }
+  return ended;
+}
 
-  for (uint16_t i = 0; i < blockSize_; ++i) {
-    float synthSum = 0.0f;
-    uint8_t activeVoicesNow = 0;
+template <uint8_t Filter>
+void SynthEngine::renderSynthBus(const SynthParams& p, uint16_t offset, uint16_t n) {
+  const float driveGain = 1.0f + p.distDrive * 5.5f;
+  const float invDrive = 1.0f / driveGain;
+  for (uint16_t i = offset; i < offset + n; ++i) {
+    const float mono = synthBus_[i] * polyGain_[voiceCount_[i]] * p.gainTrim;
+    synthBus_[i] = dsp::fastTanh(mono * driveGain) * invDrive;
+  }
+  filter_.processBlock<Filter>(synthBus_ + offset, synthL_ + offset, n);
+  busChannels_ = 1;
+}
 
-    for (uint8_t vi = 0; vi < activeTarget; ++vi) {
-      Voice& v = *activeList[vi];
-      if (!v.active) continue;
-      const float env = v.env.process();
-      if (!v.env.active() && env <= 0.00001f) {
-        v.active = false;
-        continue;
-      }
-      activeVoicesNow++;
+template <uint8_t Filter, bool Mono>
+void SynthEngine::synthKernel(SynthEngine& self, const SynthParams& p, uint16_t offset, uint16_t n) {
+  self.renderVoices<Mono>(p, offset, n);
+  self.markStage(SYNTH_STAGE_VOICES);
+  self.renderSynthBus<Filter>(p, offset, n);
+}
 
-      v.phaseA += incA[vi];
-      if (v.phaseA >= 1.0f) v.phaseA -= 1.0f;
-      v.phaseB += incB[vi];
-      if (v.phaseB >= 1.0f) v.phaseB -= 1.0f;
+const SynthEngine::SynthKernel SynthEngine::kSynthKernels[2][3] = {
+    {&SynthEngine::synthKernel<0, false>, &SynthEngine::synthKernel<1, false>, &SynthEngine::synthKernel<2, false>},
+    {&SynthEngine::synthKernel<0, true>, &SynthEngine::synthKernel<1, true>, &SynthEngine::synthKernel<2, true>},
+};
+
+template <bool Mono>
+void SynthEngine::renderVoicesQ(const SynthParams& p, uint16_t offset, uint16_t n) {
+  int32_t* bus = synthBusQ_ + offset;
+  uint8_t* count = voiceCount_ + offset;
+  memset(bus, 0, sizeof(int32_t) * n);
+  memset(count, 0, n);
 
-      const float a = osc(p.waveA, v.phaseA);
-      const float b = osc(p.waveB, v.phaseB);
-      const float s = ((1.0f - p.oscMix) * a + p.oscMix * b) * env * v.vel;
-      synthSum += s;
+  if (Mono) {
+    for (uint32_t m = voices_.activeMask & ~1u; m; m &= m - 1) freeVoice(lowestBit(m));
+  }
+  const uint32_t split = postVoiceJob(p, n);
+  uint32_t ended = renderVoiceSetQ(p, voices_.activeMask & ~split, bus, count, envBufQ_, n);
+  if (split) {
+    if (joinVoiceJob()) {
+      for (uint16_t i = 0; i < n; ++i) {
+        bus[i] += workerBusQ_[i];
+        count[i] += workerCount_[i];
+      }
+      ended |= job_.ended;
+    } else {
+      ended |= renderVoiceSetQ(p, split, bus, count, envBufQ_, n);
     }
+  }
+  freeVoices(ended);
+}
 
-    const float polyGain = activeVoicesNow > 0 ? (0.25f / sqrtf(static_cast<float>(activeVoicesNow))) : 0.0f;
-    float mono = synthSum * polyGain * p.gainTrim;
+uint32_t SynthEngine::renderVoiceSetQ(const SynthParams& p, uint32_t mask, int32_t* bus, uint8_t* count,
+                                      int32_t* env, uint16_t n) {
+  const int32_t mixA = dsp::toQ15(1.0f - p.oscMix);
+  const int32_t mixB = dsp::toQ15(p.oscMix);
+  uint32_t ended = 0;
+  for (uint32_t m = mask; m; m &= m - 1) {
+    const uint8_t vi = lowestBit(m);
+
+    const uint8_t note = voices_.note[vi];
+    const float noteHz = dsp::midiToHz(note);
+    const float lowNoteScale = dsp::clampf((static_cast<float>(note) - 24.0f) / 60.0f, 0.35f, 1.0f);
+    const float detune = p.detuneCents * lowNoteScale;
+    const float detuneRatio = powf(2.0f, detune / 1200.0f);
+    const uint32_t incA = dsp::phaseIncrement(noteHz, static_cast<float>(sampleRate_));
+    const uint32_t incB = dsp::phaseIncrement(noteHz * detuneRatio, static_cast<float>(sampleRate_));
+    const int16_t* tableA = dsp::wavetable(p.waveA, incA);
+    const int16_t* tableB = dsp::wavetable(p.waveB, incB);
+    // Table samples are scaled by 1 / kWavetablePeak; fold the peak back in with velocity.
+    const int32_t velQ = dsp::toQ15(voices_.vel[vi] * dsp::kWavetablePeak);
+    uint32_t phaseA = voices_.phaseA[vi];
+    uint32_t phaseB = voices_.phaseB[vi];
+
+    const uint16_t live = voices_.envQ[vi].processBlock(env, n);
+    if (live < n) ended |= 1u << vi;
+
+    for (uint16_t i = 0; i < live; ++i) {
+      const int32_t e = env[i] >> 16;
+      count[i]++;
+
+      phaseA += incA;
+      phaseB += incB;
+
+      const int32_t a = dsp::wavetableReadQ(tableA, phaseA);
+      const int32_t b = dsp::wavetableReadQ(tableB, phaseB);
+      int32_t s = (mixA * a + mixB * b + (1 << 14)) >> 15;
+      s = (s * e + (1 << 14)) >> 15;
+      bus[i] += (s * velQ + (1 << 14)) >> 15;
+    }
 
-    const float driveGain = 1.0f + p.distDrive * 5.5f;
-    mono = dsp::fastTanh(mono * driveGain) / driveGain;
+    voices_.phaseA[vi] = phaseA;
+    voices_.phaseB[vi] = phaseB;
+  }
+  return ended;
+}
 
-    float synthL = filterL_.process(mono);
-    float synthR = filterR_.process(mono);
+void SynthEngine::renderSynthBusQ(const SynthParams& p, uint16_t offset, uint16_t n) {
+  int32_t gain[kMaxVoices + 1];
+  for (uint8_t k = 0; k <= kMaxVoices; ++k) gain[k] = dsp::toQ15(polyGain_[k] * p.gainTrim);
 
-    float drumL = 0.0f;
-    float drumR = 0.0f;
-    if (drumsEnabled_) drum_.render(drumL, drumR);
+  const float driveGain = 1.0f + p.distDrive * 5.5f;
+  const int32_t driveQ = dsp::toQ15(driveGain);
+  const int32_t invDriveQ = dsp::toQ15(1.0f / driveGain);
+  for (uint16_t i = offset; i < offset + n; ++i) {
+    const int32_t mono = dsp::mulQ15(synthBusQ_[i], gain[voiceCount_[i]]);
+    synthBusQ_[i] = dsp::mulQ15(dsp::fastTanhQ15(dsp::mulQ15(mono, driveQ)), invDriveQ);
+  }
+  filterQ_.processBlock(synthBusQ_ + offset, synthLQ_ + offset, n);
+  busChannels_ = 1;
+}
 
-    float mixL = synthL + drumL;
-    float mixR = synthR + drumR;
+template <bool Mono>
+void SynthEngine::synthKernelQ(SynthEngine& self, const SynthParams& p, uint16_t offset, uint16_t n) {
+  self.renderVoicesQ<Mono>(p, offset, n);
+  self.markStage(SYNTH_STAGE_VOICES);
+  self.renderSynthBusQ(p, offset, n);
+}
 
-    const uint32_t readPos = (delayPos_ + kMaxDelaySamples - delaySamples) % kMaxDelaySamples;
-    const float d = static_cast<float>(delay_[readPos]) / 127.0f;
+const SynthEngine::SynthKernel SynthEngine::kSynthKernelsQ[2] = {
+    &SynthEngine::synthKernelQ<false>,
+    &SynthEngine::synthKernelQ<true>,
+};
 
-    const float writeL = dsp::clampf(mixL + d * p.delayFeedback, -1.0f, 1.0f);
-    const float writeR = dsp::clampf(mixR + d * p.delayFeedback, -1.0f, 1.0f);
-    const float writeMono = 0.5f * (writeL + writeR);
-    delay_[delayPos_] = static_cast<int8_t>(writeMono * 127.0f);
+void SynthEngine::widenBus(uint16_t n) {
+  if (busChannels_ == 2) return;
+  if (fixedPoint_) {
+    memcpy(synthRQ_, synthLQ_, sizeof(int32_t) * n);
+  } else {
+    memcpy(synthR_, synthL_, sizeof(float) * n);
+  }
+  busChannels_ = 2;
+}
+
+// Drums render slice by slice next to the voices. renderBlock() only draws
+// noise while a part is sounding, so skipping idle slices changes nothing;
+// the first live slice of a block zero-fills the ones before it.
+void SynthEngine::renderDrums(uint16_t offset, uint16_t n) {
+  if (!drumsLive_) {
+    if (!drumsEnabled_ || !drum_.active()) return;
+    memset(drumL_, 0, sizeof(float) * offset);
+    memset(drumR_, 0, sizeof(float) * offset);
+    drumsLive_ = true;
+  }
+  drum_.renderBlock(drumL_ + offset, drumR_ + offset, n);
+}
+
+// Panned drums are the first stereo stage; idle drums leave the bus mono.
+void SynthEngine::mixDrums(uint16_t n) {
+  if (!drumsLive_) return;
+  widenBus(n);
+  if (fixedPoint_) {
+    for (uint16_t i = 0; i < n; ++i) {
+      synthLQ_[i] += dsp::toQ15(drumL_[i]);
+      synthRQ_[i] += dsp::toQ15(drumR_[i]);
+    }
+    return;
+  }
+  for (uint16_t i = 0; i < n; ++i) {
+    synthL_[i] += drumL_[i];
+    synthR_[i] += drumR_[i];
+  }
+}
 
-    mixL = mixL * (1.0f - p.delayMix) + d * p.delayMix;
-    mixR = mixR * (1.0f - p.delayMix) + d * p.delayMix;
+// Runs the mono delay line over the bus in place.
+template <bool Stereo>
+void SynthEngine::renderDelay(const SynthParams& p, uint16_t n) {
+  delay_.setDelay(p.delayMs * static_cast<float>(sampleRate_) / 1000.0f, delayGlide_, n);
 
-    delayPos_++;
-    if (delayPos_ >= kMaxDelaySamples) delayPos_ = 0;
+  for (uint16_t i = 0; i < n; ++i) {
+    const float mixL = synthL_[i];
+    const float mixR = Stereo ? synthR_[i] : mixL;
 
-    revMemL_ = revMemL_ * 0.974f + mixL * 0.026f;
-    revMemR_ = revMemR_ * 0.972f + mixR * 0.028f;
-    const float revL = revMemL_ * 0.62f + revMemR_ * 0.15f;
-    const float revR = revMemR_ * 0.62f + revMemL_ * 0.15f;
+    const float d = static_cast<float>(delay_.read()) * (1.0f / 32767.0f);
 
-    mixL += revL * p.reverb;
-    mixR += revR * p.reverb;
+    const float writeL = dsp::clampf(mixL + d * p.delayFeedback, -1.0f, 1.0f);
+    const float writeMono = Stereo ? 0.5f * (writeL + dsp::clampf(mixR + d * p.delayFeedback, -1.0f, 1.0f)) : writeL;
+    delay_.write(static_cast<int32_t>(writeMono * 32767.0f));
+
+    synthL_[i] = mixL * (1.0f - p.delayMix) + d * p.delayMix;
+    if (Stereo) synthR_[i] = mixR * (1.0f - p.delayMix) + d * p.delayMix;
+  }
+}
 
-    mixL *= p.master;
-    mixR *= p.master;
+// Adds the wet reverb to the (stereo) bus. The network only runs while the
+// send is up and is cleared when it comes back, so no stale tail replays.
+// Under load the governor drops it from half to quarter rate.
+void SynthEngine::renderReverb(const SynthParams& p, uint16_t n) {
+  if (!reverbLive_) {
+    reverb_.clear();
+    reverbLive_ = true;
+  }
+  if (fixedPoint_) {
+    for (uint16_t i = 0; i < n; ++i) reverbInQ_[i] = dsp::clampQ15((synthLQ_[i] + synthRQ_[i]) / 2);
+  } else {
+    for (uint16_t i = 0; i < n; ++i) reverbInQ_[i] = dsp::clampQ15(dsp::toQ15(0.5f * (synthL_[i] + synthR_[i])));
+  }
+  reverb_.process(reverbInQ_, reverbLQ_, reverbRQ_, n, fxLite_);
 
-    mixL = dcL_.process(mixL);
-    mixR = dcR_.process(mixR);
+  if (fixedPoint_) {
+    const int32_t wetQ = dsp::toQ15(p.reverb * kReverbWet);
+    for (uint16_t i = 0; i < n; ++i) {
+      synthLQ_[i] += dsp::mulQ15(reverbLQ_[i], wetQ);
+      synthRQ_[i] += dsp::mulQ15(reverbRQ_[i], wetQ);
+    }
+    return;
+  }
+  const float wet = p.reverb * kReverbWet / static_cast<float>(dsp::kQ15One);
+  for (uint16_t i = 0; i < n; ++i) {
+    synthL_[i] += static_cast<float>(reverbLQ_[i]) * wet;
+    synthR_[i] += static_cast<float>(reverbRQ_[i]) * wet;
+  }
+}
 
+// Master, DC block, soft clip and fade over the post-reverb mix; a mono bus
+// runs the chain once and is copied to R. Master ramps across the block from
+// the previous block's value, so even its block-rate glide steps are smooth.
+template <bool Stereo>
+void SynthEngine::renderOutput(const SynthParams& p, uint16_t n) {
+  const float masterStep = (p.master - outMaster_) / static_cast<float>(n);
+  float master = outMaster_;
+  for (uint16_t i = 0; i < n; ++i) {
+    float mixL = synthL_[i];
+    float mixR = Stereo ? synthR_[i] : mixL;
+
+    master += masterStep;
+    mixL *= master;
+    mixL = dcL_.process(mixL);
     mixL = dsp::fastTanh(mixL * 1.6f) / 1.6f;
-    mixR = dsp::fastTanh(mixR * 1.6f) / 1.6f;
+    if (Stereo) {
+      mixR *= master;
+      mixR = dcR_.process(mixR);
+      mixR = dsp::fastTanh(mixR * 1.6f) / 1.6f;
+    }
 
     if (fadeValue_ < fadeTarget_) {
       fadeValue_ += fadeStep_;
@@ -978,38 +1632,197 @@ void SynthEngine::renderBlock(const SynthParams& p) {
       if (fadeValue_ < fadeTarget_) fadeValue_ = fadeTarget_;
     }
 
-    mixL *= fadeValue_;
-    mixR *= fadeValue_;
-
-    const float outL = dsp::clampf(mixL, -1.0f, 1.0f);
-    const float outR = dsp::clampf(mixR, -1.0f, 1.0f);
+    const float outL = dsp::clampf(mixL * fadeValue_, -1.0f, 1.0f);
+    const float outR = Stereo ? dsp::clampf(mixR * fadeValue_, -1.0f, 1.0f) : outL;
 
     i2sBlock_[i * 2] = static_cast<int16_t>(outL * 32767.0f);
     i2sBlock_[i * 2 + 1] = static_cast<int16_t>(outR * 32767.0f);
+    if (floatOut_) {
+      floatOut_[i * 2] = outL;
+      floatOut_[i * 2 + 1] = outR;
+    }
   }
+  outMaster_ = p.master;
+  // Keeps the right DC blocker in step for the next stereo block.
+  if (!Stereo) dcR_ = dcL_;
 }
 
-void SynthEngine::audioTask() {
-  while (running_) {
-    SynthParams p;
-    portENTER_CRITICAL(&paramMux_);
-    p = paramsSlots_[activeParamSlot_];
-    portEXIT_CRITICAL(&paramMux_);
+template <bool Stereo>
+void SynthEngine::renderDelayQ(const SynthParams& p, uint16_t n) {
+  delay_.setDelay(p.delayMs * static_cast<float>(sampleRate_) / 1000.0f, delayGlide_, n);
 
-    Event e;
-    while (popEvent(e)) handleEvent(e, p);
+  const int32_t feedbackQ = dsp::toQ15(p.delayFeedback);
+  const int32_t wetQ = dsp::toQ15(p.delayMix);
+  const int32_t dryQ = dsp::kQ15One - wetQ;
 
-    renderBlock(p);
+  for (uint16_t i = 0; i < n; ++i) {
+    const int32_t mixL = synthLQ_[i];
+    const int32_t mixR = Stereo ? synthRQ_[i] : mixL;
 
-    size_t bytesWritten = 0;
-    const size_t bytes = static_cast<size_t>(blockSize_) * 2u * sizeof(int16_t);
-    const esp_err_t err = i2s_write(i2sPort_, i2sBlock_, bytes, &bytesWritten, 20 / portTICK_PERIOD_MS);
-    if (err != ESP_OK || bytesWritten != bytes) {
-      portENTER_CRITICAL(&eventMux_);
-      underruns_++;
-      portEXIT_CRITICAL(&eventMux_);
+    // Stored samples are int16 scale, which is Q15.
+    const int32_t d = delay_.read();
+
+    const int32_t writeL = dsp::clampQ15(mixL + dsp::mulQ15(d, feedbackQ));
+    const int32_t writeMono = Stereo ? (writeL + dsp::clampQ15(mixR + dsp::mulQ15(d, feedbackQ))) / 2 : writeL;
+    delay_.write(writeMono);
+
+    synthLQ_[i] = dsp::mulQ15(mixL, dryQ) + dsp::mulQ15(d, wetQ);
+    if (Stereo) synthRQ_[i] = dsp::mulQ15(mixR, dryQ) + dsp::mulQ15(d, wetQ);
+  }
+}
+
+template <bool Stereo>
+void SynthEngine::renderOutputQ(const SynthParams& p, uint16_t n) {
+  // Master ramps in Q15 with 15 extra fraction bits (1.0 stays below 2^31).
+  const int32_t masterFrom = dsp::toQ15(outMaster_);
+  const int32_t masterStep = ((dsp::toQ15(p.master) - masterFrom) * 32768) / n;
+  int32_t masterAcc = masterFrom * 32768;
+  const int32_t clipIn = dsp::toQ15(1.6f);
+  const int32_t clipOut = dsp::toQ15(1.0f / 1.6f);
+
+  // Fade runs in Q30 for the block and is handed back to the float state after.
+  const float q30 = 1073741824.0f;
+  int32_t fade = static_cast<int32_t>(fadeValue_ * q30);
+  const int32_t fadeTarget = static_cast<int32_t>(fadeTarget_ * q30);
+  const int32_t fadeStep = static_cast<int32_t>(fadeStep_ * q30);
+
+  for (uint16_t i = 0; i < n; ++i) {
+    int32_t mixL = synthLQ_[i];
+    int32_t mixR = Stereo ? synthRQ_[i] : mixL;
+
+    masterAcc += masterStep;
+    const int32_t masterQ = masterAcc >> 15;
+    mixL = dsp::mulQ15(mixL, masterQ);
+    mixL = dcQL_.process(mixL);
+    mixL = dsp::mulQ15(dsp::fastTanhQ15(dsp::mulQ15(mixL, clipIn)), clipOut);
+    if (Stereo) {
+      mixR = dsp::mulQ15(mixR, masterQ);
+      mixR = dcQR_.process(mixR);
+      mixR = dsp::mulQ15(dsp::fastTanhQ15(dsp::mulQ15(mixR, clipIn)), clipOut);
+    }
+
+    if (fade < fadeTarget) {
+      fade += fadeStep;
+      if (fade > fadeTarget) fade = fadeTarget;
+    } else if (fade > fadeTarget) {
+      fade -= fadeStep;
+      if (fade < fadeTarget) fade = fadeTarget;
+    }
+
+    // Same 32767 full scale as the float path.
+    const int32_t outL = dsp::clampQ15(static_cast<int32_t>((static_cast<int64_t>(mixL) * fade + (1 << 29)) >> 30));
+    const int32_t outR =
+        Stereo ? dsp::clampQ15(static_cast<int32_t>((static_cast<int64_t>(mixR) * fade + (1 << 29)) >> 30)) : outL;
+    i2sBlock_[i * 2] = dsp::saturate16(dsp::mulQ15(outL, 32767));
+    i2sBlock_[i * 2 + 1] = dsp::saturate16(dsp::mulQ15(outR, 32767));
+    if (floatOut_) {
+      floatOut_[i * 2] = static_cast<float>(outL) / static_cast<float>(dsp::kQ15One);
+      floatOut_[i * 2 + 1] = static_cast<float>(outR) / static_cast<float>(dsp::kQ15One);
+    }
+  }
+
+  fadeValue_ = static_cast<float>(fade) / q30;
+  outMaster_ = p.master;
+  if (!Stereo) dcQR_ = dcQL_;
+}
+
+const SynthEngine::BusStage SynthEngine::kDelayStages[2][2] = {
+    {&SynthEngine::renderDelay<false>, &SynthEngine::renderDelay<true>},
+    {&SynthEngine::renderDelayQ<false>, &SynthEngine::renderDelayQ<true>},
+};
+
+const SynthEngine::BusStage SynthEngine::kOutputStages[2][2] = {
+    {&SynthEngine::renderOutput<false>, &SynthEngine::renderOutput<true>},
+    {&SynthEngine::renderOutputQ<false>, &SynthEngine::renderOutputQ<true>},
+};
+
+void SynthEngine::renderBlock(const SynthParams& p, uint16_t firstEvent) {
+  applyFilterConfig(p);
+
+  // Voices and drums run slice by slice, applying each event on its own
+  // sample; every later stage runs over the whole block before the next starts.
+  // setParam() clamps filterType to 0..2, so the lookup is in range.
+  const SynthKernel kernel =
+      fixedPoint_ ? kSynthKernelsQ[p.mono ? 1 : 0] : kSynthKernels[p.mono ? 1 : 0][p.filterType];
+  drumsLive_ = false;
+  uint16_t start = 0;
+  uint16_t end = firstEvent;
+  for (;;) {
+    kernel(*this, p, start, end - start);
+    markStage(SYNTH_STAGE_FILTER);
+    renderDrums(start, end - start);
+    markStage(SYNTH_STAGE_DRUMS);
+    if (end >= blockSize_) break;
+    start = end;
+    end = applyDueEvents(p, start, blockSize_);
+    markStage(SYNTH_STAGE_EVENTS);
+  }
+  mixDrums(blockSize_);
+  markStage(SYNTH_STAGE_DRUMS);
+  const uint8_t path = fixedPoint_ ? 1 : 0;
+  (this->*kDelayStages[path][busChannels_ - 1])(p, blockSize_);
+  markStage(SYNTH_STAGE_DELAY);
+  // A wet reverb send is stereo, so it widens the bus from here on.
+  if (p.reverb > 0.0f) {
+    widenBus(blockSize_);
+    renderReverb(p, blockSize_);
+  } else {
+    reverbLive_ = false;
+  }
+  markStage(SYNTH_STAGE_REVERB);
+  (this->*kOutputStages[path][busChannels_ - 1])(p, blockSize_);
+  markStage(SYNTH_STAGE_OUTPUT);
+}
+
+void SynthEngine::renderNextBlock() {
+  memset(blockCycles_, 0, sizeof(blockCycles_));
+  stageMark_ = platform::cycleCount();
+
+  pullParams();
+  SynthParams p = paramNow_;
+  // Cross-field limits shape what is rendered, not the stored targets.
+  if (p.delayFeedback > 0.92f && p.delayMix > 0.75f) p.delayFeedback = 0.92f;
+  if (p.distDrive > 0.8f) p.master *= 0.92f;
+  govPatchVoices_ = p.maxVoices;
+  govMono_ = p.mono != 0;
+  if (p.maxVoices > voiceCap_) p.maxVoices = voiceCap_;
+
+  const uint16_t backlog = events_.size();
+  if (backlog > eventPeak_) eventPeak_ = backlog;
+  const uint16_t firstEvent = applyDueEvents(p, 0, blockSize_);
+  // Lowered polyphony (patch or governor) fades the extra voices once instead of muting them.
+  if (!p.mono) enforceVoiceLimit(p.maxVoices);
+  markStage(SYNTH_STAGE_EVENTS);
+
+  renderBlock(p, firstEvent);
+  blockClock_ += blockSize_;
+  sampleClock_.store(blockClock_, std::memory_order_release);
+}
+
+void SynthEngine::audioTask() {
+  uint32_t lastWriteUs = micros();
+  bool primed = false;
+  publishClockAnchor(lastWriteUs);
+  while (running_) {
+    renderNextBlock();
+
+    // The last write returned with the DMA queue full, so starting this one
+    // more than queueUs_ later means the DAC already ran out and played zeros.
+    const bool late = primed && micros() - lastWriteUs > queueUs_;
+    const bool written = audioOut_.write(i2sBlock_, blockSize_, 20);
+    // The write returns as a DMA buffer frees up, which paces the anchor to the DAC.
+    lastWriteUs = micros();
+    publishClockAnchor(lastWriteUs);
+    markStage(SYNTH_STAGE_I2S_WAIT);
+    governLoad(recordBlockStats());
+    profileBlocks_[latency_].fetch_add(1, std::memory_order_relaxed);
+    if (late || !written) {
+      underruns_.fetch_add(1, std::memory_order_relaxed);
+      profileUnderruns_[latency_].fetch_add(1, std::memory_order_relaxed);
     }
-    taskYIELD();
+    primed = true;
+    // Real-time mode already gave up the core while the write waited on DMA.
+    if (!taskRealtime_) platform::yieldTask();
   }
 
   taskAlive_ = false;
@@ -1,9 +1,17 @@
 #pragma once
 
 #include <Arduino.h>
-#include <driver/i2s.h>
-
+#include "audio_platform.h"
 #include "drum_engine.h"
+#include "dsp_fixed.h"
+#include "dsp_reverb.h"
+#include "note_timers.h"
+#include "spsc_ring.h"
+
+// Default render path: 0 = float, 1 = Q15/Q31 fixed point (see dsp_fixed.h).
+#ifndef BECA_FIXED_POINT
+#define BECA_FIXED_POINT 0
+#endif
 
 namespace beca {
 
@@ -13,6 +21,82 @@ enum SynthFilterType : uint8_t {
   SYNTH_FILTER_BANDPASS = 2,
 };
 
+// Render stages timed per block, in processing order.
+enum SynthStage : uint8_t {
+  SYNTH_STAGE_EVENTS = 0,
+  SYNTH_STAGE_VOICES = 1,
+  SYNTH_STAGE_FILTER = 2,
+  SYNTH_STAGE_DRUMS = 3,
+  SYNTH_STAGE_DELAY = 4,
+  SYNTH_STAGE_REVERB = 5,
+  SYNTH_STAGE_OUTPUT = 6,
+  SYNTH_STAGE_I2S_WAIT = 7,
+  SYNTH_STAGE_COUNT = 8,
+};
+
+// I2S output profiles: render block size and DMA buffer count. Trigger-to-sound
+// latency is (kStampLatencyBlocks + bufferCount) blocks; see latencyMs().
+enum SynthLatency : uint8_t {
+  SYNTH_LATENCY_ULTRA_LOW = 0,  // 32 x 3
+  SYNTH_LATENCY_NORMAL = 1,     // 64 x 4
+  SYNTH_LATENCY_SAFE = 2,       // 128 x 6
+  SYNTH_LATENCY_COUNT = 3,
+};
+
+struct SynthLatencyProfile {
+  const char* name;
+  uint16_t blockSize;
+  uint8_t bufferCount;
+};
+
+// Per-block timing since the last resetStats(), in microseconds. "render" covers
+// every stage except the I2S wait; loadHist bins are 10% of the block deadline
+// wide, the last one collecting everything from 110% up.
+struct SynthStats {
+  static constexpr uint8_t kHistBins = 12;
+
+  struct Timing {
+    float minUs;
+    float avgUs;
+    float maxUs;
+  };
+
+  uint32_t blocks;
+  uint32_t overruns;
+  float deadlineUs;
+  Timing stage[SYNTH_STAGE_COUNT];
+  Timing render;
+  uint32_t loadHist[kHistBins];
+
+  // Load governor: current degradation and the steps taken since the last reset.
+  uint8_t voiceCap;     // kMaxVoices when uncapped
+  uint8_t fxLite;       // reverb running at quarter rate
+  uint32_t voicesShed;  // releasing voices cut early
+  uint32_t fxLiteSteps;
+  uint32_t capSteps;
+  uint32_t restoreSteps;
+  uint8_t drumCap;      // drum parts allowed at once, DrumEngine::kPartCount when uncapped
+  uint32_t drumCuts;    // drum parts faded early to stay inside the drum budget
+
+  // Control -> audio event ring: deepest backlog seen at a block start,
+  // note-ons/drum hits dropped on a full ring, note-offs parked instead.
+  uint16_t eventPeak;
+  uint32_t eventsDropped;
+  uint32_t offsParked;
+
+  // Second-core voice worker: slices split across both cores, and split
+  // slices the audio task took back because the worker had not started them.
+  uint32_t parallelSlices;
+  uint32_t parallelReclaims;
+
+  // Output latency: the running profile and, per profile since boot (not
+  // cleared by resetStats), the blocks written and the DMA underruns seen.
+  uint8_t latency;
+  float latencyMs;
+  uint32_t profileBlocks[SYNTH_LATENCY_COUNT];
+  uint32_t profileUnderruns[SYNTH_LATENCY_COUNT];
+};
+
 struct SynthParams {
   uint8_t preset;
   uint8_t waveA;
@@ -36,57 +120,179 @@ struct SynthParams {
   float detuneCents;
   float gainTrim;
   uint8_t drumKit;
+  uint8_t envCurve;  // dsp::ADSR::Curve; the fixed-point path is always linear
+};
+
+// One id per SynthParams field, in declaration order, for setParam()/param().
+enum SynthParamId : uint8_t {
+  SYNTH_PARAM_PRESET = 0,
+  SYNTH_PARAM_WAVE_A,
+  SYNTH_PARAM_WAVE_B,
+  SYNTH_PARAM_OSC_MIX,
+  SYNTH_PARAM_MONO,
+  SYNTH_PARAM_MAX_VOICES,
+  SYNTH_PARAM_ATTACK,
+  SYNTH_PARAM_DECAY,
+  SYNTH_PARAM_SUSTAIN,
+  SYNTH_PARAM_RELEASE,
+  SYNTH_PARAM_FILTER_TYPE,
+  SYNTH_PARAM_CUTOFF,
+  SYNTH_PARAM_RESONANCE,
+  SYNTH_PARAM_REVERB,
+  SYNTH_PARAM_DELAY_MS,
+  SYNTH_PARAM_DELAY_FEEDBACK,
+  SYNTH_PARAM_DELAY_MIX,
+  SYNTH_PARAM_DRIVE,
+  SYNTH_PARAM_MASTER,
+  SYNTH_PARAM_DETUNE,
+  SYNTH_PARAM_GAIN_TRIM,
+  SYNTH_PARAM_DRUM_KIT,
+  SYNTH_PARAM_ENV_CURVE,
+  SYNTH_PARAM_COUNT,
 };
 
 class SynthEngine {
  public:
   static constexpr uint8_t kPresetCount = 18;
+  static constexpr uint8_t kMaxVoices = 16;
+  static_assert(kMaxVoices <= 32, "voice sets are 32-bit masks");
 
   SynthEngine();
 
-  bool start(int pinBck, int pinWs, int pinData, uint32_t sampleRate = 44100, uint16_t blockSize = 64);
+  // The latency profile sets the block size and DMA depth; to switch it at
+  // runtime, stop() and start() again.
+  bool start(int pinBck, int pinWs, int pinData, uint32_t sampleRate = 44100,
+             uint8_t latency = SYNTH_LATENCY_NORMAL);
   void stop();
   bool running() const { return running_; }
+  uint8_t latency() const { return latency_; }
+  // Real-time mode, applied by the next start(): the audio task runs at
+  // platform::kRealtimePriority and sleeps only in the I2S write while it
+  // waits for a DMA buffer, instead of also yielding after every block.
+  void setRealtime(bool enabled) { realtime_ = enabled; }
+  bool realtime() const { return realtime_; }
+  // Second-core voice rendering: a worker task on core 0 renders every other
+  // active voice of a slice into its own bus while the audio task renders the
+  // rest, and the audio task sums the two before the filter. Applies at once,
+  // running or not. A slice the worker has not started by the time the audio
+  // task finishes its own half is taken back, so a busy core 0 costs
+  // parallelism, never a missed deadline.
+  void setParallel(bool enabled);
+  bool parallel() const { return workerAlive_; }
+  static const SynthLatencyProfile& latencyProfile(uint8_t latency);
+  // Trigger to DAC: the stamp latency plus the DMA queue, in milliseconds.
+  static float latencyMs(uint8_t latency, uint32_t sampleRate);
+
+  // Offline rendering without I2S or the audio task (host tools). renderOffline()
+  // drains pending events and returns one interleaved L/R block of blockSize() frames.
+  void startOffline(uint32_t sampleRate = 44100, uint16_t blockSize = 128);
+  const int16_t* renderOffline();
+  // Same, also writing the pre-quantization output (+-1.0 full scale) to out.
+  const int16_t* renderOffline(float* out);
+  uint32_t sampleRate() const { return sampleRate_; }
+  uint16_t blockSize() const { return blockSize_; }
+
+  // Switch between the float and fixed-point render paths; meant for use while silent.
+  void setFixedPoint(bool enabled) { fixedPoint_ = enabled; }
+  bool fixedPoint() const { return fixedPoint_; }
 
   void fadeIn(uint16_t ms = 20);
   void fadeOut(uint16_t ms = 20);
 
+  // Sample clock: every event carries the sample it takes effect on, and the
+  // block is split there, so timing is exact rather than rounded to a block.
+  // sampleClock() is the first sample of the next block to render. While the
+  // audio task runs, sampleTimeAt() maps a micros() reading onto the clock
+  // with a fixed latency of kStampLatencyBlocks; offline it is sampleClock().
+  // Stamps are kept non-decreasing in push order, and stamps already in the
+  // past take effect at the start of the next block.
+  static constexpr uint8_t kStampLatencyBlocks = 2;
+  uint32_t sampleClock() const { return sampleClock_.load(std::memory_order_acquire); }
+  uint32_t sampleTimeAt(uint32_t us) const;
+  uint32_t sampleTimeNow() const;
+
+  // The untimed calls are stamped sampleTimeNow(). A gate schedules the
+  // note-off on the audio task's clock, gateMs after the note starts; a
+  // retrigger moves it, and an ungated retrigger or explicit off cancels it.
   void noteOn(uint8_t note, uint8_t vel, uint16_t gateMs = 0);
+  void noteOnAt(uint32_t at, uint8_t note, uint8_t vel, uint16_t gateMs = 0);
   void noteOff(uint8_t note);
+  void noteOffAt(uint32_t at, uint8_t note);
   void allNotesOff();
 
   void drumHit(uint8_t part, uint8_t vel);
+  void drumHitAt(uint32_t at, uint8_t part, uint8_t vel);
   void allDrumsOff();
   void setDrumsEnabled(bool enabled);
-
+  // Drum kits are SYNTH_PARAM_DRUM_KIT indices: the factory kits, then the
+  // DrumEngine::kUserKitCount user slots. Storing a user kit re-derives the
+  // drum coefficients at the next block; persisting it is up to the caller.
+  bool storeDrumKit(uint8_t slot, const DrumKitDef& kit);
+  bool drumKit(uint8_t kit, DrumKitDef& out) const { return drum_.kitDef(kit, out); }
+  uint8_t userDrumKitMask() const { return drum_.userKitMask(); }
+  // Maps the one-shot bank that sampled kit parts play (a flash partition
+  // label on the device, a file on the host). Only while stopped: voices
+  // read the bank in place.
+  bool openDrumSamples(const char* name);
+  const DrumSampleBank& drumSamples() const { return drum_.samples(); }
+
+  // Parameters are per-field atomic targets with dirty bits: setters clamp and
+  // publish only the fields that change, and the audio task picks them up at
+  // the next block with no lock. Continuous fields glide there over about
+  // kParamGlideMs, the rest switch at the block boundary.
+  static constexpr uint8_t kParamGlideMs = 20;
+  void setParam(uint8_t id, float value);
+  float param(uint8_t id) const;
   void setParams(const SynthParams& params);
   void getParams(SynthParams& out) const;
+  // Presets load through publishParams(): a table copy and one store per
+  // changed field, no clamping and no lock. Factory presets are a constexpr
+  // table in flash, range-checked at compile time against the param limits.
+  // User slots are RAM copies, clamped once when stored; persisting them is
+  // up to the caller.
+  static constexpr uint8_t kUserPresetCount = 4;
   void loadPreset(uint8_t presetIndex);
   void resetPreset();
+  bool storeUserPreset(uint8_t slot, const SynthParams& params);
+  bool userPreset(uint8_t slot, SynthParams& out) const;
+  bool loadUserPreset(uint8_t slot);
 
   bool triggerTestChord(uint32_t durationMs = 2000);
-  void service(uint32_t nowMs);
 
   uint32_t consumeUnderruns();
 
+  void getStats(SynthStats& out) const;
+  void resetStats();
+
+  // Deadline-aware load governor. Above highPct of the block deadline it sheds the
+  // quietest releasing voice, then drops reverb quality, then caps polyphony, one
+  // step per few blocks. Below lowPct for about a second it undoes one step.
+  // While drums play they hold kDrumBudgetPct of the deadline: the synth is
+  // judged against what is left, and the drum engine may sound only as many
+  // parts as their measured cost fits in the reservation.
+  static constexpr uint8_t kDrumBudgetPct = 20;
+  void setLoadGovernor(bool enabled, uint8_t highPct = 85, uint8_t lowPct = 60);
+  bool loadGovernor() const { return govEnabled_.load(std::memory_order_relaxed); }
+  static const char* stageName(uint8_t stage);
+
   static const char* presetName(uint8_t index);
   static void presetDefaults(uint8_t index, SynthParams& out);
 
  private:
-  struct Voice {
-    bool active;
-    uint8_t note;
-    uint32_t age;
-    float phaseA;
-    float phaseB;
-    float vel;
-    dsp::ADSR env;
-  };
-
-  struct NoteOffSched {
-    bool active;
-    uint8_t note;
-    uint32_t atMs;
+  // Structure-of-arrays voice state: index i in every array belongs to voice i.
+  // The active and free lists are the set and clear bits of activeMask, so taking
+  // the lowest free voice, freeing one and walking the sounding ones are all bit ops.
+  struct VoiceBank {
+    uint32_t activeMask;
+    uint32_t dyingMask;       // active voices in a short fade after a steal or cut
+    uint8_t noteVoice[128];   // voice holding each MIDI note, kNoVoice if none
+    uint8_t note[kMaxVoices];
+    uint32_t age[kMaxVoices];
+    uint32_t phaseA[kMaxVoices];
+    uint32_t phaseB[kMaxVoices];
+    float vel[kMaxVoices];
+    dsp::ADSR env[kMaxVoices];
+    dsp::ADSRq envQ[kMaxVoices];
   };
 
   enum EventType : uint8_t {
@@ -98,78 +304,292 @@ class SynthEngine {
   };
 
   struct Event {
+    uint32_t at;    // sample clock
+    uint32_t gate;  // note-on: samples until its note-off, 0 for none
     uint8_t type;
     uint8_t a;
     uint8_t b;
   };
 
-  static constexpr uint8_t kMaxVoices = 8;
+  static constexpr uint8_t kNoVoice = 0xFF;
+  static constexpr uint32_t kAllVoices = (kMaxVoices >= 32) ? 0xFFFFFFFFu : ((1u << kMaxVoices) - 1u);
   static constexpr uint8_t kEventQueueSize = 64;
-  static constexpr uint8_t kOffSchedSize = 24;
+  // Ring slots only note-offs and all-off events may use.
+  static constexpr uint8_t kEventReserve = 8;
   static constexpr uint16_t kBlockMax = 128;
+  static_assert(kBlockMax <= dsp::Reverb::kMaxBlock, "reverb scratch is smaller than a block");
+  // Internal mu-law delay line (800 ms at 44.1 kHz); PSRAM gets a linear one sized for kMaxDelayMs.
   static constexpr uint32_t kMaxDelaySamples = 35280;
+  static constexpr uint32_t kMaxDelayMs = 800;
+
+  // Cycle totals per stage; index SYNTH_STAGE_COUNT holds the render total.
+  struct StageAccum {
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t sumCycles;
+  };
 
   static void taskTrampoline(void* arg);
   void audioTask();
 
-  bool pushEvent(uint8_t type, uint8_t a, uint8_t b);
-  bool popEvent(Event& out);
+  // Voice worker handshake: the audio task fills job_ and marks it posted;
+  // whichever side moves jobState_ off JOB_POSTED first renders the job.
+  enum JobState : uint8_t { JOB_IDLE = 0, JOB_POSTED = 1, JOB_RUNNING = 2, JOB_DONE = 3 };
+  struct VoiceJob {
+    const SynthParams* p;
+    uint32_t mask;
+    uint32_t ended;  // voices whose envelope finished; the audio task frees them
+    uint16_t n;
+  };
+  // Splitting a slice costs a wake-up and a join, so small ones stay on one core.
+  static constexpr uint8_t kParallelMinVoices = 4;
+  static constexpr uint16_t kParallelMinFrames = 16;
+  static void workerTrampoline(void* arg);
+  void workerTask();
+  uint32_t postVoiceJob(const SynthParams& p, uint16_t n);
+  bool joinVoiceJob();
+  void freeVoices(uint32_t mask);
+
+  bool pushEvent(uint32_t at, uint8_t type, uint8_t a, uint8_t b, uint32_t gate = 0);
+  uint32_t msToSamples(uint32_t ms) const;
+  // Applies the gates and events due by `offset` into the current block and
+  // returns the offset of the next one, or n when none is due before the block ends.
+  uint16_t applyDueEvents(const SynthParams& p, uint16_t offset, uint16_t n);
+  void applyParked(uint32_t beforeIndex, const SynthParams& p);
+  void applyParkedAllOffs(uint32_t beforeIndex, const SynthParams& p);
+  void applyParkedOffs(uint32_t beforeIndex, const SynthParams& p);
+  void publishClockAnchor(uint32_t us);
 
   void handleEvent(const Event& e, const SynthParams& p);
-  void renderBlock(const SynthParams& p);
-  float osc(uint8_t waveform, float phase) const;
-  Voice* allocVoice(uint8_t note, bool monoMode);
+  // One kernel per filter x mono combination, picked once per block. Waveforms are
+  // all wavetable reads, so they only change which table a voice points at.
+  // Kernels render the block slice [offset, offset + n) between two events.
+  typedef void (*SynthKernel)(SynthEngine& self, const SynthParams& p, uint16_t offset, uint16_t n);
+  static const SynthKernel kSynthKernels[2][3];
+  template <uint8_t Filter, bool Mono>
+  static void synthKernel(SynthEngine& self, const SynthParams& p, uint16_t offset, uint16_t n);
+  template <bool Mono>
+  void renderVoices(const SynthParams& p, uint16_t offset, uint16_t n);
+  // Adds the voices in `mask` into bus/count; returns those whose envelope ended.
+  uint32_t renderVoiceSet(const SynthParams& p, uint32_t mask, float* bus, uint8_t* count, float* env, uint16_t n);
+  template <uint8_t Filter>
+  void renderSynthBus(const SynthParams& p, uint16_t offset, uint16_t n);
+
+  // Fixed-point kernels, indexed by mono; the Q28 biquad covers every filter shape.
+  static const SynthKernel kSynthKernelsQ[2];
+  template <bool Mono>
+  static void synthKernelQ(SynthEngine& self, const SynthParams& p, uint16_t offset, uint16_t n);
+  template <bool Mono>
+  void renderVoicesQ(const SynthParams& p, uint16_t offset, uint16_t n);
+  uint32_t renderVoiceSetQ(const SynthParams& p, uint32_t mask, int32_t* bus, uint8_t* count, int32_t* env,
+                           uint16_t n);
+  void renderSynthBusQ(const SynthParams& p, uint16_t offset, uint16_t n);
+
+  void renderNextBlock();
+  void renderBlock(const SynthParams& p, uint16_t firstEvent);
+  // Mix bus stages after the synth kernel. The bus starts each block mono in
+  // synthL_/synthLQ_ and widens at the first stage that needs stereo; each
+  // stage is instantiated per channel count and picked by [fixed][channels - 1].
+  typedef void (SynthEngine::*BusStage)(const SynthParams& p, uint16_t n);
+  static const BusStage kDelayStages[2][2];
+  static const BusStage kOutputStages[2][2];
+  void widenBus(uint16_t n);
+  void renderDrums(uint16_t offset, uint16_t n);
+  void mixDrums(uint16_t n);
+  template <bool Stereo>
+  void renderDelay(const SynthParams& p, uint16_t n);
+  template <bool Stereo>
+  void renderDelayQ(const SynthParams& p, uint16_t n);
+  void renderReverb(const SynthParams& p, uint16_t n);
+  template <bool Stereo>
+  void renderOutput(const SynthParams& p, uint16_t n);
+  template <bool Stereo>
+  void renderOutputQ(const SynthParams& p, uint16_t n);
+
+  // Charges the cycles since the previous mark to one stage of the current block.
+  void markStage(uint8_t stage) {
+    const uint32_t now = platform::cycleCount();
+    blockCycles_[stage] += now - stageMark_;
+    stageMark_ = now;
+  }
+  uint32_t recordBlockStats();
+  void governLoad(uint32_t renderCycles);
+  bool budgetDrums(uint32_t drumCycles);
+  bool shedQuietestReleasing();
+  void resetGovernor();
+  void resetRenderState();
+  void attachDelayStorage();
+  uint8_t allocVoice(uint8_t note, const SynthParams& p);
+  void freeVoice(uint8_t idx);
+  void fadeOutVoice(uint8_t idx);
+  uint8_t pickVictim(uint32_t candidates) const;
+  bool voiceReleasing(uint8_t idx) const;
+  float voiceLevel(uint8_t idx) const;
+  void enforceVoiceLimit(uint8_t maxVoices);
+  uint8_t liveVoiceCount() const;
+  void resetVoice(uint8_t idx);
   void applyFilterConfig(const SynthParams& p);
-  void sanitizeParams(SynthParams& p) const;
+  void publishParams(const SynthParams& params);
+  void pullParams();
 
-  i2s_port_t i2sPort_;
+  platform::AudioOut audioOut_;
   uint32_t sampleRate_;
   uint16_t blockSize_;
+  bool fixedPoint_;
+  float* floatOut_;
 
-  TaskHandle_t audioTaskHandle_;
   volatile bool running_;
   volatile bool taskAlive_;
-
-  mutable portMUX_TYPE paramMux_;
-  SynthParams paramsSlots_[2];
-  volatile uint8_t activeParamSlot_;
-
-  portMUX_TYPE eventMux_;
-  Event eventQueue_[kEventQueueSize];
-  volatile uint8_t eventHead_;
-  volatile uint8_t eventTail_;
-
-  Voice voices_[kMaxVoices];
+  bool realtime_;
+  bool taskRealtime_;
+  volatile bool workerRun_;
+  volatile bool workerAlive_;
+
+  // Targets as float bits, written by the control task; a set bit in
+  // paramDirty_ means the audio task has not read that field yet. The audio
+  // task keeps its own copy of the targets and the smoothed values it renders
+  // with; paramGliding_ marks the fields still on their way.
+  static_assert(SYNTH_PARAM_COUNT <= 32, "dirty bits are one word");
+  std::atomic<uint32_t> paramTargets_[SYNTH_PARAM_COUNT];
+  std::atomic<uint32_t> paramDirty_;
+  SynthParams paramTarget_;
+  SynthParams paramNow_;
+  uint32_t paramGliding_;
+  float paramGlide_;
+  float outMaster_;
+
+  // Control task only.
+  SynthParams userPresets_[kUserPresetCount];
+  uint8_t userPresetMask_;
+
+  // Written by the control task only, read by the audio task only. Events
+  // that find the ring full are parked: note-offs as bits in parkedOffs_,
+  // all-offs as the ring index they belong before (plus one; 0 is none).
+  // Parked note-offs share one index, that of the latest; the audio task
+  // moves them to heldOffs_ and applies them once the ring reaches it.
+  SpscRing<Event, kEventQueueSize> events_;
+  uint32_t lastStamp_;
+  std::atomic<uint32_t> parkedOffs_[4];
+  std::atomic<uint32_t> parkedOffsBefore_;
+  uint32_t heldOffs_[4];
+  uint32_t heldOffsBefore_;
+  std::atomic<uint32_t> parkedAllNotesOff_;
+  std::atomic<uint32_t> parkedAllDrumsOff_;
+  std::atomic<uint32_t> eventsDropped_;
+  std::atomic<uint32_t> offsParked_;
+  uint16_t eventPeak_;
+
+  // Sample clock, advanced by the audio task after each block. The anchor
+  // pairs a clock value with the micros() it was reached at, published under
+  // a sequence count so the control task never reads a torn pair.
+  std::atomic<uint32_t> sampleClock_;
+  std::atomic<uint32_t> anchorSeq_;
+  std::atomic<uint32_t> anchorSample_;
+  std::atomic<uint32_t> anchorUs_;
+  uint32_t blockClock_;
+  bool drumsLive_;
+
+  VoiceBank voices_;
   uint32_t voiceAgeCounter_;
-  NoteOffSched offSched_[kOffSchedSize];
+  float polyGain_[kMaxVoices + 1];
+  // Pending gate note-offs by note, on the sample clock; audio task only.
+  NoteTimers<128> gates_;
 
   DrumEngine drum_;
 
-  dsp::Biquad filterL_;
-  dsp::Biquad filterR_;
+  dsp::Biquad filter_;
   dsp::DCBlocker dcL_;
   dsp::DCBlocker dcR_;
+  dsp::BiquadTable filterTable_;
   uint8_t lastFilterType_;
-  float lastCutoffHz_;
-  float lastResonance_;
+  float filterPos_;
+  float filterRes_;
+  float filterGlide_;
   bool filterDirty_;
-
-  int8_t delay_[kMaxDelaySamples];
-  uint32_t delayPos_;
-  float revMemL_;
-  float revMemR_;
-
+  dsp::BiquadQ filterQ_;
+  dsp::DCBlockerQ dcQL_;
+  dsp::DCBlockerQ dcQR_;
+
+  uint8_t delayLaw_[kMaxDelaySamples];
+  int16_t* delayPcm_;
+  uint32_t delayPcmLength_;
+  dsp::DelayLine delay_;
+  float delayGlide_;
+  dsp::Reverb reverb_;
+  bool reverbLive_;
+
+  // Per-block scratch buses, one stage writes a whole block before the next reads it.
+  float synthBus_[kBlockMax];
+  uint8_t voiceCount_[kBlockMax];
+  float envBuf_[kBlockMax];
+  int32_t envBufQ_[kBlockMax];
+  float synthL_[kBlockMax];
+  float synthR_[kBlockMax];
+  float drumL_[kBlockMax];
+  float drumR_[kBlockMax];
+  int32_t synthBusQ_[kBlockMax];
+  int32_t synthLQ_[kBlockMax];
+  int32_t synthRQ_[kBlockMax];
+  int32_t reverbInQ_[kBlockMax];
+  int32_t reverbLQ_[kBlockMax];
+  int32_t reverbRQ_[kBlockMax];
+  uint8_t busChannels_;
   int16_t i2sBlock_[kBlockMax * 2];
 
-  volatile uint32_t underruns_;
+  // Voice worker: the job and the worker's own bus and envelope scratch.
+  VoiceJob job_;
+  std::atomic<uint8_t> jobState_;
+  platform::Signal jobReady_;
+  float workerBus_[kBlockMax];
+  int32_t workerBusQ_[kBlockMax];
+  uint8_t workerCount_[kBlockMax];
+  float workerEnv_[kBlockMax];
+  int32_t workerEnvQ_[kBlockMax];
+  uint32_t parallelSlices_;
+  uint32_t parallelReclaims_;
+
+  // A write that starts later than the DMA queue lasts found it drained.
+  std::atomic<uint32_t> underruns_;
+  // Latency profile in use, how long its DMA queue lasts, and per-profile
+  // blocks written and underruns since boot.
+  uint8_t latency_;
+  uint32_t queueUs_;
+  std::atomic<uint32_t> profileBlocks_[SYNTH_LATENCY_COUNT];
+  std::atomic<uint32_t> profileUnderruns_[SYNTH_LATENCY_COUNT];
+
+  uint32_t stageMark_;
+  uint32_t blockCycles_[SYNTH_STAGE_COUNT];
+  uint32_t deadlineCycles_;
+  mutable platform::CriticalSection statsLock_;
+  StageAccum stageAccum_[SYNTH_STAGE_COUNT + 1];
+  uint32_t statBlocks_;
+  uint32_t statOverruns_;
+  uint32_t loadHist_[SynthStats::kHistBins];
+
+  // Set from any task. Thresholds are packed high << 8 | low so a block never
+  // sees one from before a change and one from after; the rest of the
+  // governor state belongs to the audio task, which a disable asks to reset.
+  std::atomic<bool> govEnabled_;
+  std::atomic<uint16_t> govThresholds_;
+  std::atomic<bool> govResetPending_;
+  float govLoadAvg_;
+  uint16_t govCooldown_;
+  uint16_t govCalmBlocks_;
+  uint8_t govPatchVoices_;
+  bool govMono_;
+  volatile uint8_t voiceCap_;
+  volatile bool fxLite_;
+  uint32_t govShed_;
+  uint32_t govFxLiteSteps_;
+  uint32_t govCapSteps_;
+  uint32_t govRestoreSteps_;
+  float govDrumPartCycles_;  // smoothed drum cost per part-frame
+  uint16_t govDrumHold_;     // blocks left holding the drum reservation
+  uint32_t govDrumCuts_;
 
   volatile float fadeTarget_;
   float fadeValue_;
   float fadeStep_;
-
-  bool testToneActive_;
-  uint32_t testToneEndMs_;
-  uint8_t testNotes_[3];
   volatile bool drumsEnabled_;
 };
 
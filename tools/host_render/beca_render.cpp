@@ -0,0 +1,526 @@
+// Renders a timestamped event script through SynthEngine/DrumEngine to a WAV
+// file, with no I2S or audio task involved. Output is deterministic: the same
+// script and options always produce the same file.
+//
+//   ./beca_render song.txt out.wav
+//   ./beca_render --float --fixed --rate 48000 song.txt out.wav
+//   ./beca_render - out.wav < song.txt
+//
+// Script format, one event per line, '#' starts a comment:
+//
+//   <ms> note <note> <vel> [len_ms]   note on, with an optional gate length
+//   <ms> off <note>                   note off
+//   <ms> drum <part> <vel>            drum hit (parts 0..7)
+//   <ms> preset <index>               load a factory preset
+//   <ms> param <name> <value>         set one /api/synth field (cutoff, release, ...)
+//   <ms> all_off                      all notes and drums off
+//   <ms> end                          stop rendering here
+//
+// Without an "end" line the render stops --tail ms after the last event.
+// Notes and drum hits land on the exact sample of their timestamp; presets,
+// params and all_off take effect at the start of the block containing it.
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "synth_engine.h"
+
+namespace {
+
+enum ScriptOp : uint8_t {
+  OP_NOTE_ON,
+  OP_NOTE_OFF,
+  OP_DRUM,
+  OP_PRESET,
+  OP_PARAM,
+  OP_ALL_OFF,
+  OP_END,
+};
+
+struct ScriptEvent {
+  double ms;
+  uint8_t op;
+  uint8_t a;
+  uint8_t b;
+  char name[24];
+  float value;
+};
+
+struct Options {
+  const char* scriptPath;
+  const char* wavPath;
+  uint32_t sampleRate;
+  uint16_t blockSize;
+  bool floatWav;
+  bool fixedPoint;
+  bool drums;
+  int preset;
+  double tailMs;
+  int governorPct;
+  bool parallel;
+  const char* kitPath;
+  const char* samplesPath;
+  double silentAfterMs;  // < 0: no check
+};
+
+// Keep the 35 KB delay line off the stack.
+beca::SynthEngine gSynth;
+
+bool byteArg(const char* s, int lo, int hi, uint8_t& out) {
+  char* end = nullptr;
+  const long v = strtol(s, &end, 10);
+  if (end == s || *end != '\0' || v < lo || v > hi) return false;
+  out = static_cast<uint8_t>(v);
+  return true;
+}
+
+// Field names match the /api/synth query arguments.
+bool applyParam(beca::SynthParams& p, const char* name, float v) {
+  const uint8_t u = static_cast<uint8_t>(v < 0.0f ? 0.0f : (v > 255.0f ? 255.0f : v));
+  if (strcmp(name, "wave_a") == 0) p.waveA = u;
+  else if (strcmp(name, "wave_b") == 0) p.waveB = u;
+  else if (strcmp(name, "osc_mix") == 0) p.oscMix = v;
+  else if (strcmp(name, "mono") == 0) p.mono = u != 0 ? 1 : 0;
+  else if (strcmp(name, "voices") == 0) p.maxVoices = u;
+  else if (strcmp(name, "attack") == 0) p.attack = v;
+  else if (strcmp(name, "decay") == 0) p.decay = v;
+  else if (strcmp(name, "sustain") == 0) p.sustain = v;
+  else if (strcmp(name, "release") == 0) p.release = v;
+  else if (strcmp(name, "filter") == 0) p.filterType = u;
+  else if (strcmp(name, "cutoff") == 0) p.cutoffHz = v;
+  else if (strcmp(name, "resonance") == 0) p.resonance = v;
+  else if (strcmp(name, "reverb") == 0) p.reverb = v;
+  else if (strcmp(name, "delay_ms") == 0) p.delayMs = v;
+  else if (strcmp(name, "delay_feedback") == 0) p.delayFeedback = v;
+  else if (strcmp(name, "delay_mix") == 0) p.delayMix = v;
+  else if (strcmp(name, "drive") == 0) p.distDrive = v;
+  else if (strcmp(name, "master") == 0) p.master = v;
+  else if (strcmp(name, "detune") == 0) p.detuneCents = v;
+  else if (strcmp(name, "gain_trim") == 0) p.gainTrim = v;
+  else if (strcmp(name, "drumkit") == 0) p.drumKit = u;
+  else if (strcmp(name, "env_curve") == 0) p.envCurve = u;
+  else return false;
+  return true;
+}
+
+bool parseLine(char* line, unsigned lineNo, std::vector<ScriptEvent>& out) {
+  char* hash = strchr(line, '#');
+  if (hash) *hash = '\0';
+
+  char* tok[5] = {nullptr, nullptr, nullptr, nullptr, nullptr};
+  uint8_t count = 0;
+  for (char* t = strtok(line, " \t\r\n"); t; t = strtok(nullptr, " \t\r\n")) {
+    if (count == 5) {
+      fprintf(stderr, "line %u: too many fields\n", lineNo);
+      return false;
+    }
+    tok[count++] = t;
+  }
+  if (count == 0) return true;
+
+  ScriptEvent e;
+  memset(&e, 0, sizeof(e));
+  char* end = nullptr;
+  e.ms = strtod(tok[0], &end);
+  if (end == tok[0] || *end != '\0' || e.ms < 0.0 || count < 2) {
+    fprintf(stderr, "line %u: expected '<ms> <command> ...'\n", lineNo);
+    return false;
+  }
+
+  const char* cmd = tok[1];
+  bool ok = true;
+  if (strcmp(cmd, "note") == 0 && (count == 4 || count == 5)) {
+    e.op = OP_NOTE_ON;
+    ok = byteArg(tok[2], 0, 127, e.a) && byteArg(tok[3], 1, 127, e.b);
+    if (ok && count == 5) {
+      const double len = strtod(tok[4], &end);
+      ok = end != tok[4] && *end == '\0' && len >= 0.0;
+      if (ok) {
+        ScriptEvent off = e;
+        off.op = OP_NOTE_OFF;
+        off.ms = e.ms + len;
+        out.push_back(off);
+      }
+    }
+  } else if (strcmp(cmd, "off") == 0 && count == 3) {
+    e.op = OP_NOTE_OFF;
+    ok = byteArg(tok[2], 0, 127, e.a);
+  } else if (strcmp(cmd, "drum") == 0 && count == 4) {
+    e.op = OP_DRUM;
+    ok = byteArg(tok[2], 0, beca::DrumEngine::kPartCount - 1, e.a) && byteArg(tok[3], 1, 127, e.b);
+  } else if (strcmp(cmd, "preset") == 0 && count == 3) {
+    e.op = OP_PRESET;
+    ok = byteArg(tok[2], 0, beca::SynthEngine::kPresetCount - 1, e.a);
+  } else if (strcmp(cmd, "param") == 0 && count == 4) {
+    e.op = OP_PARAM;
+    beca::SynthParams probe;
+    memset(&probe, 0, sizeof(probe));
+    ok = strlen(tok[2]) < sizeof(e.name) && applyParam(probe, tok[2], 0.0f);
+    if (ok) {
+      strcpy(e.name, tok[2]);
+      e.value = strtof(tok[3], &end);
+      ok = end != tok[3] && *end == '\0';
+    }
+  } else if (strcmp(cmd, "all_off") == 0 && count == 2) {
+    e.op = OP_ALL_OFF;
+  } else if (strcmp(cmd, "end") == 0 && count == 2) {
+    e.op = OP_END;
+  } else {
+    ok = false;
+  }
+
+  if (!ok) {
+    fprintf(stderr, "line %u: bad '%s' event\n", lineNo, cmd);
+    return false;
+  }
+  out.push_back(e);
+  return true;
+}
+
+bool loadScript(const char* path, std::vector<ScriptEvent>& out) {
+  FILE* f = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+  if (!f) {
+    fprintf(stderr, "cannot open %s\n", path);
+    return false;
+  }
+  char line[256];
+  unsigned lineNo = 0;
+  bool ok = true;
+  while (ok && fgets(line, sizeof(line), f)) ok = parseLine(line, ++lineNo, out);
+  if (f != stdin) fclose(f);
+
+  // Gate note-offs were appended next to their note-ons; keep same-time order otherwise.
+  std::stable_sort(out.begin(), out.end(),
+                   [](const ScriptEvent& x, const ScriptEvent& y) { return x.ms < y.ms; });
+  return ok;
+}
+
+// A kit blob (see DrumEngine::parseKitBlob) into user kit slot 0.
+bool loadKit(const char* path) {
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    fprintf(stderr, "cannot open %s\n", path);
+    return false;
+  }
+  uint8_t blob[beca::DrumEngine::kKitBlobBytes + 1];
+  const size_t len = fread(blob, 1, sizeof(blob), f);
+  fclose(f);
+  beca::DrumKitDef kit;
+  if (!beca::DrumEngine::parseKitBlob(blob, len, kit)) {
+    fprintf(stderr, "%s: not a %u-byte kit blob\n", path, static_cast<unsigned>(beca::DrumEngine::kKitBlobBytes));
+    return false;
+  }
+  return gSynth.storeDrumKit(0, kit);
+}
+
+// `at` is the event's sample on the engine clock, which starts at 0 with the render.
+void applyEvent(const ScriptEvent& e, uint32_t at) {
+  switch (e.op) {
+    case OP_NOTE_ON:
+      gSynth.noteOnAt(at, e.a, e.b);
+      break;
+    case OP_NOTE_OFF:
+      gSynth.noteOffAt(at, e.a);
+      break;
+    case OP_DRUM:
+      gSynth.drumHitAt(at, e.a, e.b);
+      break;
+    case OP_PRESET:
+      gSynth.loadPreset(e.a);
+      break;
+    case OP_PARAM: {
+      beca::SynthParams p;
+      gSynth.getParams(p);
+      applyParam(p, e.name, e.value);
+      gSynth.setParams(p);
+      break;
+    }
+    case OP_ALL_OFF:
+      gSynth.allNotesOff();
+      gSynth.allDrumsOff();
+      break;
+    default:
+      break;
+  }
+}
+
+// Little-endian RIFF writer; sizes are patched in finish().
+class WavWriter {
+ public:
+  WavWriter() : f_(nullptr), floatFormat_(false), frames_(0) {}
+
+  bool open(const char* path, uint32_t sampleRate, bool floatFormat) {
+    f_ = fopen(path, "wb");
+    if (!f_) return false;
+    floatFormat_ = floatFormat;
+    const uint16_t bytesPerSample = floatFormat ? 4 : 2;
+    put("RIFF");
+    put32(0);
+    put("WAVE");
+    put("fmt ");
+    put32(floatFormat ? 18 : 16);
+    put16(floatFormat ? 3 : 1);  // WAVE_FORMAT_IEEE_FLOAT / WAVE_FORMAT_PCM
+    put16(2);
+    put32(sampleRate);
+    put32(sampleRate * 2u * bytesPerSample);
+    put16(2 * bytesPerSample);
+    put16(bytesPerSample * 8);
+    if (floatFormat) {
+      put16(0);
+      put("fact");
+      put32(4);
+      put32(0);
+    }
+    put("data");
+    put32(0);
+    return true;
+  }
+
+  void write16(const int16_t* lr, uint16_t frames) {
+    for (uint32_t i = 0; i < frames * 2u; ++i) put16(static_cast<uint16_t>(lr[i]));
+    frames_ += frames;
+  }
+
+  void writeFloat(const float* lr, uint16_t frames) {
+    for (uint32_t i = 0; i < frames * 2u; ++i) {
+      uint32_t bits;
+      memcpy(&bits, &lr[i], sizeof(bits));
+      put32(bits);
+    }
+    frames_ += frames;
+  }
+
+  bool finish() {
+    if (!f_) return false;
+    const uint32_t dataBytes = frames_ * 2u * (floatFormat_ ? 4u : 2u);
+    const uint32_t header = floatFormat_ ? 58u : 44u;
+    fseek(f_, 4, SEEK_SET);
+    put32(header - 8u + dataBytes);
+    if (floatFormat_) {
+      fseek(f_, 46, SEEK_SET);
+      put32(frames_);
+    }
+    fseek(f_, static_cast<long>(header - 4u), SEEK_SET);
+    put32(dataBytes);
+    const bool ok = ferror(f_) == 0;
+    fclose(f_);
+    f_ = nullptr;
+    return ok;
+  }
+
+  uint32_t frames() const { return frames_; }
+
+ private:
+  void put(const char* tag) { fwrite(tag, 1, 4, f_); }
+  void put16(uint16_t v) {
+    const uint8_t b[2] = {static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8)};
+    fwrite(b, 1, 2, f_);
+  }
+  void put32(uint32_t v) {
+    const uint8_t b[4] = {static_cast<uint8_t>(v), static_cast<uint8_t>(v >> 8), static_cast<uint8_t>(v >> 16),
+                          static_cast<uint8_t>(v >> 24)};
+    fwrite(b, 1, 4, f_);
+  }
+
+  FILE* f_;
+  bool floatFormat_;
+  uint32_t frames_;
+};
+
+void usage(const char* argv0) {
+  fprintf(stderr,
+          "usage: %s [options] <script|-> <out.wav>\n"
+          "  --rate HZ      sample rate (default 44100)\n"
+          "  --block N      block size in frames, 32..128 (default 128)\n"
+          "  --float        write 32-bit float WAV instead of 16-bit PCM\n"
+          "  --fixed        use the fixed-point render path\n"
+          "  --preset N     preset loaded before the first event (default 0)\n"
+          "  --no-drums     ignore drum events\n"
+          "  --tail MS      render time after the last event (default 2000)\n"
+          "  --governor PCT run the load governor against host render time, shedding\n"
+          "                 above PCT%% of the block deadline (off by default; output\n"
+          "                 then depends on host speed)\n"
+          "  --parallel     split voices with the second-core worker thread (fixed-point\n"
+          "                 output is unchanged; float sums differ in the last bits)\n"
+          "  --kit FILE     load a drum kit blob into user slot 0 (select it with\n"
+          "                 \"param drumkit 4\")\n"
+          "  --samples FILE map a drum sample bank from make_drum_samples.py, played\n"
+          "                 by the Sampled kit (\"param drumkit 3\")\n"
+          "  --silent-after MS  fail unless the output is silent from MS on (checks\n"
+          "                 that hits and notes actually end)\n",
+          argv0);
+}
+
+bool parseOptions(int argc, char** argv, Options& o) {
+  o.scriptPath = nullptr;
+  o.wavPath = nullptr;
+  o.sampleRate = 44100;
+  o.blockSize = 128;
+  o.floatWav = false;
+  o.fixedPoint = false;
+  o.drums = true;
+  o.preset = 0;
+  o.tailMs = 2000.0;
+  o.governorPct = 0;
+  o.parallel = false;
+  o.kitPath = nullptr;
+  o.samplesPath = nullptr;
+  o.silentAfterMs = -1.0;
+
+  for (int i = 1; i < argc; ++i) {
+    const char* a = argv[i];
+    const bool hasValue = i + 1 < argc;
+    if (strcmp(a, "--rate") == 0 && hasValue) {
+      o.sampleRate = static_cast<uint32_t>(atol(argv[++i]));
+    } else if (strcmp(a, "--block") == 0 && hasValue) {
+      o.blockSize = static_cast<uint16_t>(atoi(argv[++i]));
+    } else if (strcmp(a, "--float") == 0) {
+      o.floatWav = true;
+    } else if (strcmp(a, "--fixed") == 0) {
+      o.fixedPoint = true;
+    } else if (strcmp(a, "--preset") == 0 && hasValue) {
+      o.preset = atoi(argv[++i]);
+    } else if (strcmp(a, "--no-drums") == 0) {
+      o.drums = false;
+    } else if (strcmp(a, "--tail") == 0 && hasValue) {
+      o.tailMs = atof(argv[++i]);
+    } else if (strcmp(a, "--governor") == 0 && hasValue) {
+      o.governorPct = atoi(argv[++i]);
+    } else if (strcmp(a, "--parallel") == 0) {
+      o.parallel = true;
+    } else if (strcmp(a, "--kit") == 0 && hasValue) {
+      o.kitPath = argv[++i];
+    } else if (strcmp(a, "--samples") == 0 && hasValue) {
+      o.samplesPath = argv[++i];
+    } else if (strcmp(a, "--silent-after") == 0 && hasValue) {
+      o.silentAfterMs = atof(argv[++i]);
+    } else if (a[0] == '-' && a[1] != '\0') {
+      return false;
+    } else if (!o.scriptPath) {
+      o.scriptPath = a;
+    } else if (!o.wavPath) {
+      o.wavPath = a;
+    } else {
+      return false;
+    }
+  }
+  return o.scriptPath && o.wavPath && o.preset >= 0 && o.preset < beca::SynthEngine::kPresetCount &&
+         o.tailMs >= 0.0 && o.governorPct >= 0 && o.governorPct <= 200;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Options opt;
+  if (!parseOptions(argc, argv, opt)) {
+    usage(argv[0]);
+    return 2;
+  }
+
+  std::vector<ScriptEvent> events;
+  if (!loadScript(opt.scriptPath, events)) return 1;
+  if (opt.kitPath && !loadKit(opt.kitPath)) return 1;
+  if (opt.samplesPath && !gSynth.openDrumSamples(opt.samplesPath)) {
+    fprintf(stderr, "%s: not a drum sample bank\n", opt.samplesPath);
+    return 1;
+  }
+
+  gSynth.setFixedPoint(opt.fixedPoint);
+  if (opt.governorPct > 0) {
+    gSynth.setLoadGovernor(true, static_cast<uint8_t>(opt.governorPct), static_cast<uint8_t>(opt.governorPct * 7 / 10));
+  } else {
+    gSynth.setLoadGovernor(false);
+  }
+  // Loaded before startOffline() so the first block already runs on it, without a glide.
+  gSynth.loadPreset(static_cast<uint8_t>(opt.preset));
+  gSynth.startOffline(opt.sampleRate, opt.blockSize);
+  gSynth.setDrumsEnabled(opt.drums);
+  gSynth.setParallel(opt.parallel);
+  // The engine clamps rate and block size; use what it actually runs at.
+  const uint32_t sr = gSynth.sampleRate();
+  const uint16_t block = gSynth.blockSize();
+
+  double endMs = events.empty() ? 0.0 : events.back().ms + opt.tailMs;
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (events[i].op == OP_END) {
+      endMs = events[i].ms;
+      break;
+    }
+  }
+  const uint64_t totalFrames = static_cast<uint64_t>(ceil(endMs * sr / 1000.0));
+
+  WavWriter wav;
+  if (!wav.open(opt.wavPath, sr, opt.floatWav)) {
+    fprintf(stderr, "cannot write %s\n", opt.wavPath);
+    return 1;
+  }
+
+  std::vector<float> floatBlock(static_cast<size_t>(block) * 2u);
+  // Below one 16-bit LSB counts as silent in either output format.
+  const uint64_t silentFrom =
+      opt.silentAfterMs >= 0.0 ? static_cast<uint64_t>(opt.silentAfterMs * sr / 1000.0) : totalFrames;
+  float tailPeak = 0.0f;
+  size_t next = 0;
+  uint64_t frame = 0;
+  while (frame < totalFrames) {
+    const uint64_t blockEnd = frame + block;
+    while (next < events.size()) {
+      const uint64_t at = static_cast<uint64_t>(events[next].ms * sr / 1000.0);
+      if (at >= blockEnd) break;
+      applyEvent(events[next++], static_cast<uint32_t>(at));
+    }
+
+    const uint16_t keep = static_cast<uint16_t>(std::min<uint64_t>(block, totalFrames - frame));
+    const uint32_t skip = frame < silentFrom ? static_cast<uint32_t>(std::min<uint64_t>(keep, silentFrom - frame)) : 0;
+    if (opt.floatWav) {
+      gSynth.renderOffline(floatBlock.data());
+      wav.writeFloat(floatBlock.data(), keep);
+      for (uint32_t i = skip * 2u; i < keep * 2u; ++i) tailPeak = std::max(tailPeak, fabsf(floatBlock[i]) * 32768.0f);
+    } else {
+      const int16_t* lr = gSynth.renderOffline();
+      wav.write16(lr, keep);
+      for (uint32_t i = skip * 2u; i < keep * 2u; ++i) {
+        tailPeak = std::max(tailPeak, static_cast<float>(abs(static_cast<int>(lr[i]))));
+      }
+    }
+    frame = blockEnd;
+  }
+
+  gSynth.setParallel(false);
+  if (!wav.finish()) {
+    fprintf(stderr, "write error on %s\n", opt.wavPath);
+    return 1;
+  }
+  printf("%s: %u frames, %.3f s @ %u Hz, %s, %s path\n", opt.wavPath, static_cast<unsigned>(wav.frames()),
+         static_cast<double>(wav.frames()) / sr, static_cast<unsigned>(sr), opt.floatWav ? "float32" : "pcm16",
+         opt.fixedPoint ? "fixed" : "float");
+  if (opt.governorPct > 0) {
+    beca::SynthStats s;
+    gSynth.getStats(s);
+    printf("governor: %u voices shed, %u fx-lite, %u cap steps, %u restores, %u drum cuts; now cap %u, fx-lite %u, "
+           "drum cap %u\n",
+           static_cast<unsigned>(s.voicesShed), static_cast<unsigned>(s.fxLiteSteps),
+           static_cast<unsigned>(s.capSteps), static_cast<unsigned>(s.restoreSteps),
+           static_cast<unsigned>(s.drumCuts), static_cast<unsigned>(s.voiceCap), static_cast<unsigned>(s.fxLite),
+           static_cast<unsigned>(s.drumCap));
+  }
+  if (opt.parallel) {
+    beca::SynthStats s;
+    gSynth.getStats(s);
+    printf("parallel: %u slices split, %u taken back by the render thread\n",
+           static_cast<unsigned>(s.parallelSlices), static_cast<unsigned>(s.parallelReclaims));
+  }
+  if (opt.silentAfterMs >= 0.0) {
+    printf("after %.0f ms: peak %.2f LSB\n", opt.silentAfterMs, static_cast<double>(tailPeak));
+    if (tailPeak >= 1.0f) {
+      fprintf(stderr, "%s: not silent after %.0f ms\n", opt.wavPath, opt.silentAfterMs);
+      return 1;
+    }
+  }
+  return 0;
+}
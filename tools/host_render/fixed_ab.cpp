@@ -0,0 +1,84 @@
+// Renders every factory preset through the float and the fixed-point render
+// paths and reports the SNR of the fixed-point output against the float one.
+//
+//   make test               # default threshold
+//   ./fixed_ab --min-snr 35 # fail (exit 1) if any preset falls below 35 dB
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "synth_engine.h"
+
+namespace {
+
+const uint32_t kSampleRate = 44100;
+const uint16_t kBlockSize = 128;
+const uint32_t kTotalBlocks = (kSampleRate * 4) / kBlockSize;
+const uint32_t kReleaseBlock = (kSampleRate * 2) / kBlockSize;
+
+const uint8_t kChord[4] = {48, 60, 64, 67};
+const uint8_t kChordVel[4] = {100, 92, 96, 88};
+
+// Engines carry a 35 KB delay line each, keep them off the stack.
+beca::SynthEngine gFloat;
+beca::SynthEngine gFixed;
+
+void startPreset(beca::SynthEngine& e, uint8_t preset, bool fixedPoint) {
+  e.setFixedPoint(fixedPoint);
+  e.setLoadGovernor(false);  // host timing must not change what is compared
+  e.loadPreset(preset);
+  e.startOffline(kSampleRate, kBlockSize);
+  e.setDrumsEnabled(false);
+  for (uint8_t i = 0; i < 4; ++i) e.noteOn(kChord[i], kChordVel[i]);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  double minSnr = 30.0;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--min-snr") == 0 && i + 1 < argc) {
+      minSnr = atof(argv[++i]);
+    } else {
+      fprintf(stderr, "usage: %s [--min-snr dB]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  printf("%-3s %-18s %10s %10s\n", "#", "preset", "snr_db", "max_diff");
+  double worst = 1e9;
+  for (uint8_t preset = 0; preset < beca::SynthEngine::kPresetCount; ++preset) {
+    startPreset(gFloat, preset, false);
+    startPreset(gFixed, preset, true);
+
+    double signal = 0.0;
+    double noise = 0.0;
+    int maxDiff = 0;
+    for (uint32_t b = 0; b < kTotalBlocks; ++b) {
+      if (b == kReleaseBlock) {
+        for (uint8_t i = 0; i < 4; ++i) {
+          gFloat.noteOff(kChord[i]);
+          gFixed.noteOff(kChord[i]);
+        }
+      }
+      const int16_t* ref = gFloat.renderOffline();
+      const int16_t* fix = gFixed.renderOffline();
+      for (uint16_t i = 0; i < kBlockSize * 2; ++i) {
+        const int diff = static_cast<int>(fix[i]) - static_cast<int>(ref[i]);
+        signal += static_cast<double>(ref[i]) * ref[i];
+        noise += static_cast<double>(diff) * diff;
+        if (abs(diff) > maxDiff) maxDiff = abs(diff);
+      }
+    }
+
+    const double snr = noise > 0.0 ? 10.0 * log10(signal / noise) : 999.0;
+    if (snr < worst) worst = snr;
+    printf("%-3u %-18s %10.2f %10d%s\n", static_cast<unsigned>(preset), beca::SynthEngine::presetName(preset), snr,
+           maxDiff, snr < minSnr ? "  FAIL" : "");
+  }
+
+  printf("worst snr %.2f dB (threshold %.2f dB)\n", worst, minSnr);
+  return worst < minSnr ? 1 : 0;
+}
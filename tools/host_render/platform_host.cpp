@@ -0,0 +1,88 @@
+#include "audio_platform.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+
+// Host side of audio_platform.h. There is no audio device or audio task here:
+// tools drive SynthEngine::renderOffline() directly, so start() reports failure.
+// Tasks are plain threads, which is enough for the engine's voice worker.
+
+namespace beca {
+namespace platform {
+
+AudioOut::AudioOut() : open_(false), port_(0) {}
+
+bool AudioOut::begin(const AudioOutConfig&) {
+  return false;
+}
+
+bool AudioOut::write(const int16_t*, uint16_t, uint32_t) {
+  return false;
+}
+
+void AudioOut::end() {
+  open_ = false;
+}
+
+// Nanoseconds stand in for cycles, so the engine's stage timing reads in real time.
+uint32_t cycleCount() {
+  static const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0).count());
+}
+
+uint32_t cyclesPerUs() {
+  return 1000;
+}
+
+// Like a board without PSRAM, so host renders use the same delay storage as the default device.
+void* allocExternal(size_t) {
+  return nullptr;
+}
+
+void freeExternal(void*) {}
+
+MappedData::MappedData() : data_(nullptr), size_(0), handle_(0) {}
+
+// The name is a file path, mapped read-only like a flash partition.
+bool MappedData::map(const char* name) {
+  unmap();
+  const int fd = open(name, O_RDONLY);
+  if (fd < 0) return false;
+  struct stat st;
+  void* ptr = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    ptr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+  if (ptr == MAP_FAILED) return false;
+  data_ = static_cast<const uint8_t*>(ptr);
+  size_ = static_cast<size_t>(st.st_size);
+  return true;
+}
+
+void MappedData::unmap() {
+  if (!data_) return;
+  munmap(const_cast<uint8_t*>(data_), size_);
+  data_ = nullptr;
+  size_ = 0;
+}
+
+bool startTask(TaskEntry entry, const char*, uint32_t, void* arg, uint8_t, int8_t) {
+  std::thread(entry, arg).detach();
+  return true;
+}
+
+void endCurrentTask() {}
+
+void yieldTask() {
+  std::this_thread::yield();
+}
+
+}  // namespace platform
+}  // namespace beca
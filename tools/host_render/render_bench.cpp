@@ -0,0 +1,143 @@
+// Host benchmark for the render path. Each preset plays a full-polyphony chord
+// with a drum pattern on top, through the float and the fixed-point kernels,
+// and reports per-block cost, the realtime factor, the engine's own per-stage
+// averages (SynthEngine::getStats) and a hash of the output.
+// Render results are deterministic, so the hash catches unintended sound changes
+// while tuning; timings are host numbers and only meaningful relative to each other.
+//
+//   make bench
+//   ./render_bench --seconds 20 --preset 3
+//   ./render_bench --min-rt 50     # exit 1 if any run renders slower than 50x realtime
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "synth_engine.h"
+
+namespace {
+
+const uint32_t kSampleRate = 44100;
+const uint16_t kBlockSize = 128;
+
+// Enough notes to fill every voice the engine offers.
+const uint8_t kChord[beca::SynthEngine::kMaxVoices] = {36, 43, 48, 52, 55, 59, 60, 62,
+                                                       64, 67, 69, 71, 72, 74, 76, 79};
+
+beca::SynthEngine gSynth;
+
+struct RunResult {
+  double avgUs;
+  double maxUs;
+  double realtime;
+  uint32_t hash;
+  beca::SynthStats stats;
+};
+
+uint32_t fnv1a(uint32_t h, const int16_t* data, uint16_t count) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+  for (uint32_t i = 0; i < count * sizeof(int16_t); ++i) {
+    h ^= p[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+RunResult run(uint8_t preset, bool fixedPoint, double seconds) {
+  typedef std::chrono::steady_clock Clock;
+
+  gSynth.setFixedPoint(fixedPoint);
+  gSynth.setLoadGovernor(false);  // measure the full patch, and keep the hash stable
+  // Parameters set before startOffline() apply from the first block, without a glide.
+  gSynth.loadPreset(preset);
+  beca::SynthParams p;
+  gSynth.getParams(p);
+  p.maxVoices = beca::SynthEngine::kMaxVoices;
+  gSynth.setParams(p);
+  gSynth.startOffline(kSampleRate, kBlockSize);
+  gSynth.setDrumsEnabled(true);
+
+  const uint32_t blocks = static_cast<uint32_t>(seconds * kSampleRate / kBlockSize);
+  const uint32_t blocksPerBeat = (kSampleRate / 4) / kBlockSize;  // 16ths at 60 bpm
+  const uint32_t holdBlocks = blocks - blocks / 4;
+
+  RunResult r;
+  r.avgUs = 0.0;
+  r.maxUs = 0.0;
+  r.hash = 2166136261u;
+  double totalUs = 0.0;
+  for (uint32_t b = 0; b < blocks; ++b) {
+    // Retrigger the chord each bar so voices cycle through attack and release.
+    if (b % (blocksPerBeat * 16) == 0 && b < holdBlocks) {
+      for (uint8_t i = 0; i < beca::SynthEngine::kMaxVoices; ++i) gSynth.noteOn(kChord[i], 90 + (i % 4) * 8);
+    }
+    if (b % (blocksPerBeat * 16) == blocksPerBeat * 12 || b == holdBlocks) {
+      for (uint8_t i = 0; i < beca::SynthEngine::kMaxVoices; ++i) gSynth.noteOff(kChord[i]);
+    }
+    if (b % blocksPerBeat == 0) {
+      const uint8_t step = static_cast<uint8_t>((b / blocksPerBeat) % 16);
+      gSynth.drumHit(step % 4 == 0 ? 0 : 2, 110);
+      if (step % 8 == 4) gSynth.drumHit(1, 100);
+    }
+
+    const Clock::time_point t0 = Clock::now();
+    const int16_t* out = gSynth.renderOffline();
+    const double us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+
+    totalUs += us;
+    if (us > r.maxUs) r.maxUs = us;
+    r.hash = fnv1a(r.hash, out, kBlockSize * 2);
+  }
+
+  gSynth.getStats(r.stats);
+  r.avgUs = totalUs / blocks;
+  r.realtime = (blocks * 1e6 * kBlockSize / kSampleRate) / totalUs;
+  return r;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  double seconds = 10.0;
+  double minRt = 0.0;
+  int onlyPreset = -1;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--preset") == 0 && i + 1 < argc) {
+      onlyPreset = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--min-rt") == 0 && i + 1 < argc) {
+      minRt = atof(argv[++i]);
+    } else {
+      fprintf(stderr, "usage: %s [--seconds S] [--preset N] [--min-rt X]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (seconds < 1.0) seconds = 1.0;
+
+  const double budgetUs = 1e6 * kBlockSize / kSampleRate;
+  printf("%u Hz, %u-frame blocks (%.1f us budget), %.0f s per run\n", static_cast<unsigned>(kSampleRate),
+         static_cast<unsigned>(kBlockSize), budgetUs, seconds);
+  printf("%-3s %-18s %-5s %9s %9s %9s %10s ", "#", "preset", "path", "avg_us", "max_us", "x_rt", "hash");
+  for (uint8_t s = 0; s < beca::SYNTH_STAGE_I2S_WAIT; ++s) printf(" %8s", beca::SynthEngine::stageName(s));
+  printf("\n");
+
+  double worst = 1e12;
+  for (uint8_t preset = 0; preset < beca::SynthEngine::kPresetCount; ++preset) {
+    if (onlyPreset >= 0 && preset != onlyPreset) continue;
+    for (uint8_t fixedPoint = 0; fixedPoint < 2; ++fixedPoint) {
+      const RunResult r = run(preset, fixedPoint != 0, seconds);
+      if (r.realtime < worst) worst = r.realtime;
+      printf("%-3u %-18s %-5s %9.2f %9.2f %9.1f   %08x ", static_cast<unsigned>(preset),
+             beca::SynthEngine::presetName(preset), fixedPoint ? "fixed" : "float", r.avgUs, r.maxUs, r.realtime,
+             static_cast<unsigned>(r.hash));
+      for (uint8_t s = 0; s < beca::SYNTH_STAGE_I2S_WAIT; ++s) printf(" %8.2f", r.stats.stage[s].avgUs);
+      printf("%s\n", r.realtime < minRt ? "  SLOW" : "");
+    }
+  }
+
+  printf("slowest run %.1fx realtime\n", worst);
+  return worst < minRt ? 1 : 0;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+// Minimal Arduino surface so the audio engines build on a desktop host.
+// I2S, tasks and locking go through audio_platform.h (see platform_host.cpp).
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PROGMEM
+#define IRAM_ATTR
+
+template <typename T, typename L, typename H>
+inline T constrain(T x, L lo, H hi) {
+  return x < lo ? static_cast<T>(lo) : (x > hi ? static_cast<T>(hi) : x);
+}
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
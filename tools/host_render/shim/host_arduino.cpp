@@ -0,0 +1,20 @@
+#include <Arduino.h>
+
+#include <chrono>
+#include <thread>
+
+uint32_t millis() {
+  static const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - t0).count());
+}
+
+uint32_t micros() {
+  static const std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+  return static_cast<uint32_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count());
+}
+
+void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
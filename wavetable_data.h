@@ -0,0 +1,1106 @@
+// Auto-generated by make_wavetable_header.py — do not edit by hand
+#pragma once
+#include <Arduino.h>
+
+#include "dsp_blocks.h"
+
+namespace beca {
+namespace dsp {
+
+const int16_t kWavetableSine[kWavetableSize + 1] PROGMEM = {
+    0, 322, 643, 965, 1286, 1607, 1928, 2249, 2569, 2889, 3209, 3528, 3846, 4164, 4482, 4798,
+    5114, 5429, 5743, 6057, 6369, 6681, 6992, 7301, 7609, 7917, 8223, 8528, 8831, 9133, 9434, 9734,
+    10032, 10328, 10623, 10916, 11208, 11498, 11786, 12072, 12357, 12640, 12921, 13200, 13476, 13751, 14024, 14295,
+    14563, 14830, 15094, 15356, 15615, 15873, 16127, 16380, 16630, 16877, 17122, 17364, 17604, 17841, 18075, 18307,
+    18536, 18762, 18985, 19206, 19423, 19638, 19849, 20058, 20263, 20466, 20665, 20862, 21055, 21245, 21432, 21615,
+    21796, 21973, 22147, 22317, 22484, 22648, 22808, 22965, 23118, 23268, 23415, 23557, 23697, 23833, 23965, 24093,
+    24218, 24339, 24457, 24571, 24681, 24788, 24891, 24990, 25085, 25176, 25264, 25348, 25428, 25504, 25577, 25645,
+    25710, 25771, 25828, 25881, 25930, 25975, 26016, 26054, 26087, 26117, 26143, 26164, 26182, 26196, 26206, 26212,
+    26214, 26212, 26206, 26196, 26182, 26164, 26143, 26117, 26087, 26054, 26016, 25975, 25930, 25881, 25828, 25771,
+    25710, 25645, 25577, 25504, 25428, 25348, 25264, 25176, 25085, 24990, 24891, 24788, 24681, 24571, 24457, 24339,
+    24218, 24093, 23965, 23833, 23697, 23557, 23415, 23268, 23118, 22965, 22808, 22648, 22484, 22317, 22147, 21973,
+    21796, 21615, 21432, 21245, 21055, 20862, 20665, 20466, 20263, 20058, 19849, 19638, 19423, 19206, 18985, 18762,
+    18536, 18307, 18075, 17841, 17604, 17364, 17122, 16877, 16630, 16380, 16127, 15873, 15615, 15356, 15094, 14830,
+    14563, 14295, 14024, 13751, 13476, 13200, 12921, 12640, 12357, 12072, 11786, 11498, 11208, 10916, 10623, 10328,
+    10032, 9734, 9434, 9133, 8831, 8528, 8223, 7917, 7609, 7301, 6992, 6681, 6369, 6057, 5743, 5429,
+    5114, 4798, 4482, 4164, 3846, 3528, 3209, 2889, 2569, 2249, 1928, 1607, 1286, 965, 643, 322,
+    0, -322, -643, -965, -1286, -1607, -1928, -2249, -2569, -2889, -3209, -3528, -3846, -4164, -4482, -4798,
+    -5114, -5429, -5743, -6057, -6369, -6681, -6992, -7301, -7609, -7917, -8223, -8528, -8831, -9133, -9434, -9734,
+    -10032, -10328, -10623, -10916, -11208, -11498, -11786, -12072, -12357, -12640, -12921, -13200, -13476, -13751, -14024, -14295,
+    -14563, -14830, -15094, -15356, -15615, -15873, -16127, -16380, -16630, -16877, -17122, -17364, -17604, -17841, -18075, -18307,
+    -18536, -18762, -18985, -19206, -19423, -19638, -19849, -20058, -20263, -20466, -20665, -20862, -21055, -21245, -21432, -21615,
+    -21796, -21973, -22147, -22317, -22484, -22648, -22808, -22965, -23118, -23268, -23415, -23557, -23697, -23833, -23965, -24093,
+    -24218, -24339, -24457, -24571, -24681, -24788, -24891, -24990, -25085, -25176, -25264, -25348, -25428, -25504, -25577, -25645,
+    -25710, -25771, -25828, -25881, -25930, -25975, -26016, -26054, -26087, -26117, -26143, -26164, -26182, -26196, -26206, -26212,
+    -26214, -26212, -26206, -26196, -26182, -26164, -26143, -26117, -26087, -26054, -26016, -25975, -25930, -25881, -25828, -25771,
+    -25710, -25645, -25577, -25504, -25428, -25348, -25264, -25176, -25085, -24990, -24891, -24788, -24681, -24571, -24457, -24339,
+    -24218, -24093, -23965, -23833, -23697, -23557, -23415, -23268, -23118, -22965, -22808, -22648, -22484, -22317, -22147, -21973,
+    -21796, -21615, -21432, -21245, -21055, -20862, -20665, -20466, -20263, -20058, -19849, -19638, -19423, -19206, -18985, -18762,
+    -18536, -18307, -18075, -17841, -17604, -17364, -17122, -16877, -16630, -16380, -16127, -15873, -15615, -15356, -15094, -14830,
+    -14563, -14295, -14024, -13751, -13476, -13200, -12921, -12640, -12357, -12072, -11786, -11498, -11208, -10916, -10623, -10328,
+    -10032, -9734, -9434, -9133, -8831, -8528, -8223, -7917, -7609, -7301, -6992, -6681, -6369, -6057, -5743, -5429,
+    -5114, -4798, -4482, -4164, -3846, -3528, -3209, -2889, -2569, -2249, -1928, -1607, -1286, -965, -643, -322,
+    0,
+};
+
+const int16_t kWavetableSaw[kWavetableLevels][kWavetableSize + 1] PROGMEM = {
+    {  // level 0, 170 harmonics
+        0, -27359, -28524, -23359, -26569, -26625, -24287, -25981, -25954, -24411, -25540, -25489, -24323, -25155, -25095, -24147,
+        -24797, -24733, -23928, -24455, -24387, -23684, -24121, -24052, -23424, -23794, -23724, -23153, -23471, -23400, -22875, -23151,
+        -23079, -22592, -22833, -22761, -22305, -22517, -22444, -22015, -22202, -22129, -21722, -21888, -21815, -21427, -21575, -21502,
+        -21131, -21263, -21190, -20833, -20951, -20878, -20535, -20640, -20567, -20235, -20329, -20256, -19935, -20018, -19946, -19634,
+        -19708, -19635, -19332, -19398, -19326, -19030, -19089, -19016, -18728, -18779, -18706, -18425, -18470, -18397, -18122, -18161,
+        -18088, -17818, -17852, -17779, -17515, -17543, -17470, -17211, -17234, -17162, -16906, -16926, -16853, -16602, -16617, -16545,
+        -16297, -16309, -16236, -15992, -16000, -15928, -15687, -15692, -15620, -15382, -15384, -15312, -15077, -15075, -15003, -14772,
+        -14767, -14695, -14466, -14459, -14387, -14161, -14151, -14079, -13855, -13843, -13772, -13550, -13535, -13464, -13244, -13227,
+        -13156, -12938, -12919, -12848, -12632, -12611, -12540, -12326, -12304, -12233, -12020, -11996, -11925, -11714, -11688, -11617,
+        -11408, -11380, -11310, -11102, -11072, -11002, -10795, -10765, -10695, -10489, -10457, -10387, -10183, -10149, -10079, -9877,
+        -9841, -9772, -9570, -9534, -9464, -9264, -9226, -9157, -8957, -8918, -8850, -8651, -8611, -8542, -8344, -8303,
+        -8235, -8038, -7996, -7927, -7731, -7688, -7620, -7424, -7380, -7313, -7118, -7073, -7005, -6811, -6765, -6698,
+        -6504, -6458, -6391, -6198, -6150, -6083, -5891, -5843, -5776, -5584, -5535, -5469, -5278, -5228, -5161, -4971,
+        -4920, -4854, -4664, -4612, -4547, -4357, -4305, -4240, -4050, -3997, -3933, -3743, -3690, -3625, -3437, -3382,
+        -3318, -3130, -3075, -3011, -2823, -2767, -2704, -2516, -2460, -2397, -2209, -2152, -2090, -1902, -1845, -1782,
+        -1595, -1537, -1475, -1288, -1230, -1168, -981, -922, -861, -674, -615, -554, -367, -307, -247, -60,
+        0, 60, 247, 307, 367, 554, 615, 674, 861, 922, 981, 1168, 1230, 1288, 1475, 1537,
+        1595, 1782, 1845, 1902, 2090, 2152, 2209, 2397, 2460, 2516, 2704, 2767, 2823, 3011, 3075, 3130,
+        3318, 3382, 3437, 3625, 3690, 3743, 3933, 3997, 4050, 4240, 4305, 4357, 4547, 4612, 4664, 4854,
+        4920, 4971, 5161, 5228, 5278, 5469, 5535, 5584, 5776, 5843, 5891, 6083, 6150, 6198, 6391, 6458,
+        6504, 6698, 6765, 6811, 7005, 7073, 7118, 7313, 7380, 7424, 7620, 7688, 7731, 7927, 7996, 8038,
+        8235, 8303, 8344, 8542, 8611, 8651, 8850, 8918, 8957, 9157, 9226, 9264, 9464, 9534, 9570, 9772,
+        9841, 9877, 10079, 10149, 10183, 10387, 10457, 10489, 10695, 10765, 10795, 11002, 11072, 11102, 11310, 11380,
+        11408, 11617, 11688, 11714, 11925, 11996, 12020, 12233, 12304, 12326, 12540, 12611, 12632, 12848, 12919, 12938,
+        13156, 13227, 13244, 13464, 13535, 13550, 13772, 13843, 13855, 14079, 14151, 14161, 14387, 14459, 14466, 14695,
+        14767, 14772, 15003, 15075, 15077, 15312, 15384, 15382, 15620, 15692, 15687, 15928, 16000, 15992, 16236, 16309,
+        16297, 16545, 16617, 16602, 16853, 16926, 16906, 17162, 17234, 17211, 17470, 17543, 17515, 17779, 17852, 17818,
+        18088, 18161, 18122, 18397, 18470, 18425, 18706, 18779, 18728, 19016, 19089, 19030, 19326, 19398, 19332, 19635,
+        19708, 19634, 19946, 20018, 19935, 20256, 20329, 20235, 20567, 20640, 20535, 20878, 20951, 20833, 21190, 21263,
+        21131, 21502, 21575, 21427, 21815, 21888, 21722, 22129, 22202, 22015, 22444, 22517, 22305, 22761, 22833, 22592,
+        23079, 23151, 22875, 23400, 23471, 23153, 23724, 23794, 23424, 24052, 24121, 23684, 24387, 24455, 23928, 24733,
+        24797, 24147, 25095, 25155, 24323, 25489, 25540, 24411, 25954, 25981, 24287, 26625, 26569, 23359, 28524, 27359,
+        0,
+    },
+    {  // level 1, 170 harmonics
+        0, -27359, -28524, -23359, -26569, -26625, -24287, -25981, -25954, -24411, -25540, -25489, -24323, -25155, -25095, -24147,
+        -24797, -24733, -23928, -24455, -24387, -23684, -24121, -24052, -23424, -23794, -23724, -23153, -23471, -23400, -22875, -23151,
+        -23079, -22592, -22833, -22761, -22305, -22517, -22444, -22015, -22202, -22129, -21722, -21888, -21815, -21427, -21575, -21502,
+        -21131, -21263, -21190, -20833, -20951, -20878, -20535, -20640, -20567, -20235, -20329, -20256, -19935, -20018, -19946, -19634,
+        -19708, -19635, -19332, -19398, -19326, -19030, -19089, -19016, -18728, -18779, -18706, -18425, -18470, -18397, -18122, -18161,
+        -18088, -17818, -17852, -17779, -17515, -17543, -17470, -17211, -17234, -17162, -16906, -16926, -16853, -16602, -16617, -16545,
+        -16297, -16309, -16236, -15992, -16000, -15928, -15687, -15692, -15620, -15382, -15384, -15312, -15077, -15075, -15003, -14772,
+        -14767, -14695, -14466, -14459, -14387, -14161, -14151, -14079, -13855, -13843, -13772, -13550, -13535, -13464, -13244, -13227,
+        -13156, -12938, -12919, -12848, -12632, -12611, -12540, -12326, -12304, -12233, -12020, -11996, -11925, -11714, -11688, -11617,
+        -11408, -11380, -11310, -11102, -11072, -11002, -10795, -10765, -10695, -10489, -10457, -10387, -10183, -10149, -10079, -9877,
+        -9841, -9772, -9570, -9534, -9464, -9264, -9226, -9157, -8957, -8918, -8850, -8651, -8611, -8542, -8344, -8303,
+        -8235, -8038, -7996, -7927, -7731, -7688, -7620, -7424, -7380, -7313, -7118, -7073, -7005, -6811, -6765, -6698,
+        -6504, -6458, -6391, -6198, -6150, -6083, -5891, -5843, -5776, -5584, -5535, -5469, -5278, -5228, -5161, -4971,
+        -4920, -4854, -4664, -4612, -4547, -4357, -4305, -4240, -4050, -3997, -3933, -3743, -3690, -3625, -3437, -3382,
+        -3318, -3130, -3075, -3011, -2823, -2767, -2704, -2516, -2460, -2397, -2209, -2152, -2090, -1902, -1845, -1782,
+        -1595, -1537, -1475, -1288, -1230, -1168, -981, -922, -861, -674, -615, -554, -367, -307, -247, -60,
+        0, 60, 247, 307, 367, 554, 615, 674, 861, 922, 981, 1168, 1230, 1288, 1475, 1537,
+        1595, 1782, 1845, 1902, 2090, 2152, 2209, 2397, 2460, 2516, 2704, 2767, 2823, 3011, 3075, 3130,
+        3318, 3382, 3437, 3625, 3690, 3743, 3933, 3997, 4050, 4240, 4305, 4357, 4547, 4612, 4664, 4854,
+        4920, 4971, 5161, 5228, 5278, 5469, 5535, 5584, 5776, 5843, 5891, 6083, 6150, 6198, 6391, 6458,
+        6504, 6698, 6765, 6811, 7005, 7073, 7118, 7313, 7380, 7424, 7620, 7688, 7731, 7927, 7996, 8038,
+        8235, 8303, 8344, 8542, 8611, 8651, 8850, 8918, 8957, 9157, 9226, 9264, 9464, 9534, 9570, 9772,
+        9841, 9877, 10079, 10149, 10183, 10387, 10457, 10489, 10695, 10765, 10795, 11002, 11072, 11102, 11310, 11380,
+        11408, 11617, 11688, 11714, 11925, 11996, 12020, 12233, 12304, 12326, 12540, 12611, 12632, 12848, 12919, 12938,
+        13156, 13227, 13244, 13464, 13535, 13550, 13772, 13843, 13855, 14079, 14151, 14161, 14387, 14459, 14466, 14695,
+        14767, 14772, 15003, 15075, 15077, 15312, 15384, 15382, 15620, 15692, 15687, 15928, 16000, 15992, 16236, 16309,
+        16297, 16545, 16617, 16602, 16853, 16926, 16906, 17162, 17234, 17211, 17470, 17543, 17515, 17779, 17852, 17818,
+        18088, 18161, 18122, 18397, 18470, 18425, 18706, 18779, 18728, 19016, 19089, 19030, 19326, 19398, 19332, 19635,
+        19708, 19634, 19946, 20018, 19935, 20256, 20329, 20235, 20567, 20640, 20535, 20878, 20951, 20833, 21190, 21263,
+        21131, 21502, 21575, 21427, 21815, 21888, 21722, 22129, 22202, 22015, 22444, 22517, 22305, 22761, 22833, 22592,
+        23079, 23151, 22875, 23400, 23471, 23153, 23724, 23794, 23424, 24052, 24121, 23684, 24387, 24455, 23928, 24733,
+        24797, 24147, 25095, 25155, 24323, 25489, 25540, 24411, 25954, 25981, 24287, 26625, 26569, 23359, 28524, 27359,
+        0,
+    },
+    {  // level 2, 128 harmonics
+        0, -22838, -30700, -26468, -23257, -25517, -27333, -25564, -24083, -25276, -26242, -25077, -24106, -24908, -25534, -24642,
+        -23915, -24515, -24957, -24222, -23638, -24113, -24440, -23806, -23317, -23708, -23956, -23393, -22971, -23301, -23491, -22981,
+        -22609, -22893, -23040, -22570, -22237, -22485, -22597, -22159, -21858, -22076, -22160, -21749, -21473, -21668, -21728, -21339,
+        -21084, -21258, -21299, -20929, -20692, -20849, -20874, -20519, -20297, -20440, -20450, -20109, -19901, -20031, -20028, -19699,
+        -19503, -19621, -19607, -19289, -19104, -19212, -19188, -18880, -18703, -18802, -18770, -18470, -18302, -18393, -18352, -18060,
+        -17900, -17984, -17935, -17651, -17497, -17574, -17519, -17241, -17094, -17165, -17104, -16831, -16690, -16755, -16688, -16422,
+        -16286, -16345, -16274, -16012, -15881, -15936, -15859, -15602, -15476, -15526, -15445, -15193, -15071, -15117, -15031, -14783,
+        -14666, -14707, -14618, -14373, -14260, -14298, -14204, -13964, -13854, -13888, -13791, -13554, -13448, -13479, -13378, -13145,
+        -13042, -13069, -12966, -12735, -12635, -12660, -12553, -12325, -12229, -12250, -12140, -11916, -11822, -11840, -11728, -11506,
+        -11415, -11431, -11316, -11096, -11008, -11021, -10904, -10687, -10601, -10612, -10492, -10277, -10194, -10202, -10080, -9868,
+        -9787, -9793, -9668, -9458, -9379, -9383, -9256, -9048, -8972, -8973, -8844, -8639, -8564, -8564, -8432, -8229,
+        -8157, -8154, -8021, -7820, -7749, -7745, -7609, -7410, -7342, -7335, -7198, -7001, -6934, -6925, -6786, -6591,
+        -6526, -6516, -6375, -6181, -6119, -6106, -5963, -5772, -5711, -5697, -5552, -5362, -5303, -5287, -5140, -4953,
+        -4895, -4878, -4729, -4543, -4487, -4468, -4318, -4133, -4080, -4058, -3907, -3724, -3672, -3649, -3495, -3314,
+        -3264, -3239, -3084, -2905, -2856, -2830, -2673, -2495, -2448, -2420, -2262, -2085, -2040, -2010, -1850, -1676,
+        -1632, -1601, -1439, -1266, -1224, -1191, -1028, -857, -816, -782, -617, -447, -408, -372, -206, -37,
+        0, 37, 206, 372, 408, 447, 617, 782, 816, 857, 1028, 1191, 1224, 1266, 1439, 1601,
+        1632, 1676, 1850, 2010, 2040, 2085, 2262, 2420, 2448, 2495, 2673, 2830, 2856, 2905, 3084, 3239,
+        3264, 3314, 3495, 3649, 3672, 3724, 3907, 4058, 4080, 4133, 4318, 4468, 4487, 4543, 4729, 4878,
+        4895, 4953, 5140, 5287, 5303, 5362, 5552, 5697, 5711, 5772, 5963, 6106, 6119, 6181, 6375, 6516,
+        6526, 6591, 6786, 6925, 6934, 7001, 7198, 7335, 7342, 7410, 7609, 7745, 7749, 7820, 8021, 8154,
+        8157, 8229, 8432, 8564, 8564, 8639, 8844, 8973, 8972, 9048, 9256, 9383, 9379, 9458, 9668, 9793,
+        9787, 9868, 10080, 10202, 10194, 10277, 10492, 10612, 10601, 10687, 10904, 11021, 11008, 11096, 11316, 11431,
+        11415, 11506, 11728, 11840, 11822, 11916, 12140, 12250, 12229, 12325, 12553, 12660, 12635, 12735, 12966, 13069,
+        13042, 13145, 13378, 13479, 13448, 13554, 13791, 13888, 13854, 13964, 14204, 14298, 14260, 14373, 14618, 14707,
+        14666, 14783, 15031, 15117, 15071, 15193, 15445, 15526, 15476, 15602, 15859, 15936, 15881, 16012, 16274, 16345,
+        16286, 16422, 16688, 16755, 16690, 16831, 17104, 17165, 17094, 17241, 17519, 17574, 17497, 17651, 17935, 17984,
+        17900, 18060, 18352, 18393, 18302, 18470, 18770, 18802, 18703, 18880, 19188, 19212, 19104, 19289, 19607, 19621,
+        19503, 19699, 20028, 20031, 19901, 20109, 20450, 20440, 20297, 20519, 20874, 20849, 20692, 20929, 21299, 21258,
+        21084, 21339, 21728, 21668, 21473, 21749, 22160, 22076, 21858, 22159, 22597, 22485, 22237, 22570, 23040, 22893,
+        22609, 22981, 23491, 23301, 22971, 23393, 23956, 23708, 23317, 23806, 24440, 24113, 23638, 24222, 24957, 24515,
+        23915, 24642, 25534, 24908, 24106, 25077, 26242, 25276, 24083, 25564, 27333, 25517, 23257, 26468, 30700, 22838,
+        0,
+    },
+    {  // level 3, 64 harmonics
+        0, -12656, -22801, -28817, -30495, -28961, -26096, -23708, -22849, -23558, -25070, -26363, -26717, -26031, -24782, -23682,
+        -23267, -23629, -24419, -25089, -25214, -24720, -23886, -23157, -22882, -23122, -23642, -24064, -24095, -23685, -23041, -22490,
+        -22284, -22461, -22839, -23128, -23106, -22745, -22211, -21764, -21598, -21738, -22028, -22233, -22178, -21848, -21386, -21007,
+        -20869, -20983, -21213, -21361, -21283, -20975, -20563, -20234, -20115, -20211, -20397, -20502, -20407, -20115, -19742, -19449,
+        -19346, -19427, -19579, -19652, -19545, -19265, -18921, -18657, -18566, -18635, -18761, -18808, -18690, -18421, -18101, -17860,
+        -17778, -17839, -17943, -17969, -17842, -17581, -17281, -17060, -16985, -17038, -17125, -17133, -16999, -16745, -16461, -16256,
+        -16188, -16235, -16306, -16299, -16159, -15911, -15642, -15451, -15389, -15429, -15487, -15467, -15322, -15079, -14822, -14643,
+        -14586, -14622, -14668, -14637, -14487, -14248, -14003, -13835, -13782, -13814, -13849, -13807, -13653, -13419, -13183, -13025,
+        -12976, -13004, -13030, -12979, -12821, -12591, -12364, -12215, -12169, -12194, -12211, -12152, -11990, -11763, -11545, -11403,
+        -11361, -11382, -11392, -11325, -11161, -10936, -10725, -10591, -10553, -10570, -10573, -10499, -10331, -10110, -9906, -9779,
+        -9743, -9758, -9754, -9673, -9503, -9285, -9087, -8966, -8933, -8945, -8935, -8848, -8675, -8459, -8267, -8153,
+        -8122, -8132, -8116, -8023, -7848, -7634, -7448, -7339, -7311, -7319, -7297, -7198, -7021, -6809, -6629, -6526,
+        -6499, -6505, -6478, -6374, -6194, -5985, -5810, -5712, -5688, -5691, -5659, -5550, -5368, -5161, -4991, -4897,
+        -4876, -4877, -4840, -4725, -4542, -4337, -4171, -4083, -4063, -4062, -4020, -3901, -3716, -3513, -3352, -3269,
+        -3251, -3248, -3201, -3078, -2890, -2689, -2533, -2454, -2438, -2433, -2382, -2254, -2064, -1865, -1714, -1640,
+        -1626, -1619, -1563, -1430, -1238, -1041, -895, -825, -813, -804, -744, -606, -413, -217, -75, -10,
+        0, 10, 75, 217, 413, 606, 744, 804, 813, 825, 895, 1041, 1238, 1430, 1563, 1619,
+        1626, 1640, 1714, 1865, 2064, 2254, 2382, 2433, 2438, 2454, 2533, 2689, 2890, 3078, 3201, 3248,
+        3251, 3269, 3352, 3513, 3716, 3901, 4020, 4062, 4063, 4083, 4171, 4337, 4542, 4725, 4840, 4877,
+        4876, 4897, 4991, 5161, 5368, 5550, 5659, 5691, 5688, 5712, 5810, 5985, 6194, 6374, 6478, 6505,
+        6499, 6526, 6629, 6809, 7021, 7198, 7297, 7319, 7311, 7339, 7448, 7634, 7848, 8023, 8116, 8132,
+        8122, 8153, 8267, 8459, 8675, 8848, 8935, 8945, 8933, 8966, 9087, 9285, 9503, 9673, 9754, 9758,
+        9743, 9779, 9906, 10110, 10331, 10499, 10573, 10570, 10553, 10591, 10725, 10936, 11161, 11325, 11392, 11382,
+        11361, 11403, 11545, 11763, 11990, 12152, 12211, 12194, 12169, 12215, 12364, 12591, 12821, 12979, 13030, 13004,
+        12976, 13025, 13183, 13419, 13653, 13807, 13849, 13814, 13782, 13835, 14003, 14248, 14487, 14637, 14668, 14622,
+        14586, 14643, 14822, 15079, 15322, 15467, 15487, 15429, 15389, 15451, 15642, 15911, 16159, 16299, 16306, 16235,
+        16188, 16256, 16461, 16745, 16999, 17133, 17125, 17038, 16985, 17060, 17281, 17581, 17842, 17969, 17943, 17839,
+        17778, 17860, 18101, 18421, 18690, 18808, 18761, 18635, 18566, 18657, 18921, 19265, 19545, 19652, 19579, 19427,
+        19346, 19449, 19742, 20115, 20407, 20502, 20397, 20211, 20115, 20234, 20563, 20975, 21283, 21361, 21213, 20983,
+        20869, 21007, 21386, 21848, 22178, 22233, 22028, 21738, 21598, 21764, 22211, 22745, 23106, 23128, 22839, 22461,
+        22284, 22490, 23041, 23685, 24095, 24064, 23642, 23122, 22882, 23157, 23886, 24720, 25214, 25089, 24419, 23629,
+        23267, 23682, 24782, 26031, 26717, 26363, 25070, 23558, 22849, 23708, 26096, 28961, 30495, 28817, 22801, 12656,
+        0,
+    },
+    {  // level 4, 32 harmonics
+        0, -6495, -12645, -18139, -22725, -26236, -28600, -29843, -30082, -29506, -28355, -26887, -25353, -23970, -22903, -22249,
+        -22036, -22227, -22733, -23428, -24175, -24843, -25322, -25543, -25478, -25146, -24601, -23927, -23219, -22572, -22063, -21746,
+        -21642, -21737, -21990, -22337, -22705, -23021, -23224, -23272, -23150, -22870, -22467, -21991, -21504, -21065, -20724, -20513,
+        -20444, -20506, -20668, -20886, -21109, -21286, -21375, -21351, -21205, -20948, -20608, -20223, -19840, -19501, -19242, -19084,
+        -19033, -19078, -19193, -19342, -19487, -19588, -19615, -19551, -19391, -19147, -18844, -18513, -18191, -17911, -17701, -17575,
+        -17535, -17569, -17655, -17761, -17856, -17909, -17896, -17806, -17637, -17402, -17123, -16827, -16547, -16307, -16131, -16026,
+        -15994, -16021, -16086, -16162, -16222, -16241, -16200, -16091, -15915, -15687, -15425, -15156, -14905, -14695, -14543, -14455,
+        -14428, -14449, -14499, -14553, -14587, -14580, -14517, -14393, -14213, -13989, -13741, -13492, -13264, -13077, -12944, -12869,
+        -12846, -12863, -12901, -12937, -12950, -12922, -12843, -12708, -12524, -12304, -12066, -11833, -11624, -11456, -11339, -11274,
+        -11255, -11268, -11296, -11317, -11313, -11268, -11174, -11030, -10843, -10626, -10398, -10178, -9985, -9833, -9728, -9672,
+        -9656, -9667, -9686, -9694, -9676, -9616, -9510, -9357, -9167, -8953, -8733, -8525, -8346, -8207, -8114, -8066,
+        -8052, -8060, -8072, -8070, -8038, -7965, -7848, -7689, -7496, -7284, -7071, -6874, -6707, -6581, -6498, -6456,
+        -6445, -6451, -6456, -6444, -6400, -6316, -6189, -6022, -5827, -5618, -5412, -5224, -5068, -4953, -4880, -4845,
+        -4836, -4839, -4838, -4816, -4762, -4667, -4531, -4358, -4161, -3954, -3754, -3575, -3430, -3325, -3261, -3232,
+        -3225, -3226, -3219, -3189, -3124, -3018, -2873, -2695, -2496, -2291, -2096, -1926, -1791, -1697, -1641, -1617,
+        -1613, -1612, -1599, -1560, -1485, -1370, -1217, -1033, -832, -629, -440, -278, -153, -68, -21, -3,
+        0, 3, 21, 68, 153, 278, 440, 629, 832, 1033, 1217, 1370, 1485, 1560, 1599, 1612,
+        1613, 1617, 1641, 1697, 1791, 1926, 2096, 2291, 2496, 2695, 2873, 3018, 3124, 3189, 3219, 3226,
+        3225, 3232, 3261, 3325, 3430, 3575, 3754, 3954, 4161, 4358, 4531, 4667, 4762, 4816, 4838, 4839,
+        4836, 4845, 4880, 4953, 5068, 5224, 5412, 5618, 5827, 6022, 6189, 6316, 6400, 6444, 6456, 6451,
+        6445, 6456, 6498, 6581, 6707, 6874, 7071, 7284, 7496, 7689, 7848, 7965, 8038, 8070, 8072, 8060,
+        8052, 8066, 8114, 8207, 8346, 8525, 8733, 8953, 9167, 9357, 9510, 9616, 9676, 9694, 9686, 9667,
+        9656, 9672, 9728, 9833, 9985, 10178, 10398, 10626, 10843, 11030, 11174, 11268, 11313, 11317, 11296, 11268,
+        11255, 11274, 11339, 11456, 11624, 11833, 12066, 12304, 12524, 12708, 12843, 12922, 12950, 12937, 12901, 12863,
+        12846, 12869, 12944, 13077, 13264, 13492, 13741, 13989, 14213, 14393, 14517, 14580, 14587, 14553, 14499, 14449,
+        14428, 14455, 14543, 14695, 14905, 15156, 15425, 15687, 15915, 16091, 16200, 16241, 16222, 16162, 16086, 16021,
+        15994, 16026, 16131, 16307, 16547, 16827, 17123, 17402, 17637, 17806, 17896, 17909, 17856, 17761, 17655, 17569,
+        17535, 17575, 17701, 17911, 18191, 18513, 18844, 19147, 19391, 19551, 19615, 19588, 19487, 19342, 19193, 19078,
+        19033, 19084, 19242, 19501, 19840, 20223, 20608, 20948, 21205, 21351, 21375, 21286, 21109, 20886, 20668, 20506,
+        20444, 20513, 20724, 21065, 21504, 21991, 22467, 22870, 23150, 23272, 23224, 23021, 22705, 22337, 21990, 21737,
+        21642, 21746, 22063, 22572, 23219, 23927, 24601, 25146, 25478, 25543, 25322, 24843, 24175, 23428, 22733, 22227,
+        22036, 22249, 22903, 23970, 25353, 26887, 28355, 29506, 30082, 29843, 28600, 26236, 22725, 18139, 12645, 6495,
+        0,
+    },
+    {  // level 5, 16 harmonics
+        0, -3269, -6492, -9625, -12624, -15451, -18071, -20453, -22572, -24411, -25958, -27207, -28160, -28824, -29214, -29348,
+        -29250, -28948, -28473, -27859, -27138, -26346, -25516, -24680, -23867, -23103, -22410, -21806, -21304, -20913, -20637, -20476,
+        -20424, -20472, -20610, -20822, -21091, -21401, -21731, -22065, -22384, -22673, -22916, -23104, -23226, -23276, -23252, -23153,
+        -22982, -22745, -22451, -22108, -21728, -21324, -20909, -20495, -20095, -19721, -19383, -19088, -18844, -18654, -18520, -18442,
+        -18417, -18440, -18505, -18605, -18729, -18868, -19012, -19151, -19276, -19377, -19447, -19479, -19470, -19417, -19318, -19175,
+        -18989, -18767, -18512, -18233, -17936, -17630, -17324, -17025, -16742, -16481, -16248, -16049, -15885, -15760, -15673, -15624,
+        -15608, -15622, -15661, -15718, -15788, -15862, -15933, -15995, -16040, -16064, -16062, -16029, -15964, -15865, -15733, -15569,
+        -15378, -15161, -14926, -14676, -14419, -14161, -13908, -13666, -13440, -13236, -13058, -12907, -12786, -12695, -12633, -12598,
+        -12587, -12597, -12621, -12656, -12694, -12732, -12762, -12779, -12780, -12759, -12714, -12642, -12544, -12418, -12266, -12091,
+        -11895, -11683, -11459, -11228, -10995, -10767, -10547, -10341, -10153, -9986, -9842, -9723, -9629, -9560, -9515, -9490,
+        -9483, -9489, -9503, -9522, -9540, -9552, -9554, -9541, -9510, -9459, -9384, -9285, -9163, -9018, -8853, -8669,
+        -8470, -8260, -8045, -7827, -7613, -7406, -7211, -7032, -6871, -6731, -6613, -6518, -6445, -6393, -6360, -6343,
+        -6338, -6341, -6349, -6356, -6357, -6350, -6330, -6293, -6237, -6161, -6063, -5943, -5802, -5642, -5465, -5274,
+        -5073, -4866, -4657, -4450, -4251, -4062, -3887, -3730, -3592, -3474, -3378, -3303, -3247, -3209, -3187, -3176,
+        -3173, -3174, -3176, -3172, -3160, -3136, -3097, -3039, -2962, -2865, -2746, -2608, -2450, -2277, -2090, -1893,
+        -1690, -1485, -1282, -1085, -899, -726, -569, -432, -314, -217, -140, -83, -43, -19, -6, -1,
+        0, 1, 6, 19, 43, 83, 140, 217, 314, 432, 569, 726, 899, 1085, 1282, 1485,
+        1690, 1893, 2090, 2277, 2450, 2608, 2746, 2865, 2962, 3039, 3097, 3136, 3160, 3172, 3176, 3174,
+        3173, 3176, 3187, 3209, 3247, 3303, 3378, 3474, 3592, 3730, 3887, 4062, 4251, 4450, 4657, 4866,
+        5073, 5274, 5465, 5642, 5802, 5943, 6063, 6161, 6237, 6293, 6330, 6350, 6357, 6356, 6349, 6341,
+        6338, 6343, 6360, 6393, 6445, 6518, 6613, 6731, 6871, 7032, 7211, 7406, 7613, 7827, 8045, 8260,
+        8470, 8669, 8853, 9018, 9163, 9285, 9384, 9459, 9510, 9541, 9554, 9552, 9540, 9522, 9503, 9489,
+        9483, 9490, 9515, 9560, 9629, 9723, 9842, 9986, 10153, 10341, 10547, 10767, 10995, 11228, 11459, 11683,
+        11895, 12091, 12266, 12418, 12544, 12642, 12714, 12759, 12780, 12779, 12762, 12732, 12694, 12656, 12621, 12597,
+        12587, 12598, 12633, 12695, 12786, 12907, 13058, 13236, 13440, 13666, 13908, 14161, 14419, 14676, 14926, 15161,
+        15378, 15569, 15733, 15865, 15964, 16029, 16062, 16064, 16040, 15995, 15933, 15862, 15788, 15718, 15661, 15622,
+        15608, 15624, 15673, 15760, 15885, 16049, 16248, 16481, 16742, 17025, 17324, 17630, 17936, 18233, 18512, 18767,
+        18989, 19175, 19318, 19417, 19470, 19479, 19447, 19377, 19276, 19151, 19012, 18868, 18729, 18605, 18505, 18440,
+        18417, 18442, 18520, 18654, 18844, 19088, 19383, 19721, 20095, 20495, 20909, 21324, 21728, 22108, 22451, 22745,
+        22982, 23153, 23252, 23276, 23226, 23104, 22916, 22673, 22384, 22065, 21731, 21401, 21091, 20822, 20610, 20472,
+        20424, 20476, 20637, 20913, 21304, 21806, 22410, 23103, 23867, 24680, 25516, 26346, 27138, 27859, 28473, 28948,
+        29250, 29348, 29214, 28824, 28160, 27207, 25958, 24411, 22572, 20453, 18071, 15451, 12624, 9625, 6492, 3269,
+        0,
+    },
+    {  // level 6, 8 harmonics
+        0, -1637, -3268, -4887, -6487, -8062, -9606, -11114, -12581, -14000, -15368, -16680, -17930, -19117, -20236, -21284,
+        -22258, -23158, -23980, -24724, -25389, -25975, -26481, -26910, -27261, -27537, -27739, -27870, -27932, -27929, -27863, -27739,
+        -27560, -27331, -27055, -26738, -26384, -25997, -25582, -25144, -24688, -24218, -23739, -23255, -22770, -22289, -21815, -21353,
+        -20905, -20474, -20064, -19676, -19313, -18977, -18670, -18392, -18144, -17927, -17741, -17586, -17462, -17367, -17301, -17263,
+        -17251, -17262, -17297, -17351, -17423, -17511, -17613, -17724, -17844, -17970, -18098, -18227, -18353, -18475, -18591, -18697,
+        -18792, -18875, -18943, -18995, -19029, -19045, -19042, -19018, -18975, -18910, -18825, -18720, -18595, -18450, -18287, -18106,
+        -17909, -17697, -17471, -17234, -16986, -16729, -16466, -16197, -15926, -15653, -15381, -15111, -14846, -14586, -14334, -14091,
+        -13858, -13637, -13428, -13234, -13053, -12888, -12738, -12605, -12487, -12385, -12299, -12228, -12171, -12129, -12101, -12084,
+        -12079, -12084, -12097, -12118, -12145, -12177, -12212, -12248, -12284, -12318, -12350, -12377, -12399, -12414, -12420, -12418,
+        -12405, -12381, -12345, -12297, -12235, -12161, -12073, -11972, -11857, -11730, -11590, -11437, -11273, -11099, -10914, -10721,
+        -10520, -10312, -10098, -9880, -9660, -9437, -9214, -8992, -8773, -8556, -8345, -8139, -7940, -7749, -7567, -7394,
+        -7231, -7080, -6939, -6811, -6694, -6589, -6496, -6415, -6345, -6286, -6238, -6199, -6170, -6149, -6135, -6127,
+        -6125, -6127, -6132, -6139, -6146, -6153, -6158, -6160, -6159, -6152, -6139, -6119, -6091, -6055, -6009, -5954,
+        -5888, -5811, -5723, -5624, -5514, -5394, -5262, -5120, -4968, -4807, -4637, -4459, -4274, -4083, -3887, -3686,
+        -3483, -3277, -3070, -2864, -2659, -2457, -2258, -2064, -1875, -1693, -1518, -1352, -1194, -1045, -907, -778,
+        -661, -554, -457, -371, -296, -231, -175, -129, -92, -62, -39, -23, -12, -5, -1, 0,
+        0, 0, 1, 5, 12, 23, 39, 62, 92, 129, 175, 231, 296, 371, 457, 554,
+        661, 778, 907, 1045, 1194, 1352, 1518, 1693, 1875, 2064, 2258, 2457, 2659, 2864, 3070, 3277,
+        3483, 3686, 3887, 4083, 4274, 4459, 4637, 4807, 4968, 5120, 5262, 5394, 5514, 5624, 5723, 5811,
+        5888, 5954, 6009, 6055, 6091, 6119, 6139, 6152, 6159, 6160, 6158, 6153, 6146, 6139, 6132, 6127,
+        6125, 6127, 6135, 6149, 6170, 6199, 6238, 6286, 6345, 6415, 6496, 6589, 6694, 6811, 6939, 7080,
+        7231, 7394, 7567, 7749, 7940, 8139, 8345, 8556, 8773, 8992, 9214, 9437, 9660, 9880, 10098, 10312,
+        10520, 10721, 10914, 11099, 11273, 11437, 11590, 11730, 11857, 11972, 12073, 12161, 12235, 12297, 12345, 12381,
+        12405, 12418, 12420, 12414, 12399, 12377, 12350, 12318, 12284, 12248, 12212, 12177, 12145, 12118, 12097, 12084,
+        12079, 12084, 12101, 12129, 12171, 12228, 12299, 12385, 12487, 12605, 12738, 12888, 13053, 13234, 13428, 13637,
+        13858, 14091, 14334, 14586, 14846, 15111, 15381, 15653, 15926, 16197, 16466, 16729, 16986, 17234, 17471, 17697,
+        17909, 18106, 18287, 18450, 18595, 18720, 18825, 18910, 18975, 19018, 19042, 19045, 19029, 18995, 18943, 18875,
+        18792, 18697, 18591, 18475, 18353, 18227, 18098, 17970, 17844, 17724, 17613, 17511, 17423, 17351, 17297, 17262,
+        17251, 17263, 17301, 17367, 17462, 17586, 17741, 17927, 18144, 18392, 18670, 18977, 19313, 19676, 20064, 20474,
+        20905, 21353, 21815, 22289, 22770, 23255, 23739, 24218, 24688, 25144, 25582, 25997, 26384, 26738, 27055, 27331,
+        27560, 27739, 27863, 27929, 27932, 27870, 27739, 27537, 27261, 26910, 26481, 25975, 25389, 24724, 23980, 23158,
+        22258, 21284, 20236, 19117, 17930, 16680, 15368, 14000, 12581, 11114, 9606, 8062, 6487, 4887, 3268, 1637,
+        0,
+    },
+    {  // level 7, 4 harmonics
+        0, -819, -1637, -2453, -3267, -4077, -4882, -5682, -6475, -7261, -8039, -8808, -9567, -10316, -11053, -11777,
+        -12489, -13188, -13871, -14540, -15193, -15829, -16449, -17051, -17634, -18200, -18746, -19272, -19779, -20265, -20730, -21175,
+        -21598, -21999, -22379, -22737, -23073, -23387, -23678, -23948, -24195, -24420, -24623, -24804, -24963, -25101, -25217, -25312,
+        -25386, -25440, -25473, -25487, -25481, -25456, -25413, -25352, -25273, -25177, -25065, -24936, -24793, -24635, -24462, -24276,
+        -24078, -23867, -23645, -23412, -23169, -22916, -22655, -22386, -22109, -21826, -21538, -21243, -20945, -20643, -20337, -20029,
+        -19720, -19409, -19098, -18787, -18477, -18168, -17861, -17557, -17256, -16958, -16665, -16376, -16092, -15814, -15542, -15276,
+        -15017, -14765, -14520, -14283, -14054, -13833, -13621, -13417, -13222, -13036, -12858, -12690, -12531, -12381, -12240, -12108,
+        -11985, -11872, -11767, -11671, -11583, -11504, -11433, -11371, -11316, -11269, -11229, -11196, -11169, -11150, -11136, -11128,
+        -11125, -11128, -11135, -11146, -11162, -11180, -11202, -11227, -11253, -11282, -11312, -11343, -11375, -11406, -11438, -11469,
+        -11499, -11528, -11555, -11580, -11602, -11621, -11638, -11650, -11659, -11664, -11665, -11660, -11651, -11637, -11617, -11592,
+        -11561, -11524, -11481, -11432, -11376, -11314, -11246, -11171, -11089, -11001, -10906, -10805, -10697, -10583, -10462, -10335,
+        -10202, -10063, -9918, -9767, -9611, -9450, -9283, -9111, -8935, -8755, -8570, -8381, -8189, -7993, -7795, -7593,
+        -7390, -7184, -6976, -6767, -6557, -6346, -6135, -5924, -5712, -5502, -5292, -5083, -4876, -4671, -4467, -4266,
+        -4068, -3873, -3681, -3492, -3308, -3127, -2950, -2778, -2610, -2447, -2290, -2137, -1989, -1847, -1710, -1579,
+        -1453, -1333, -1219, -1111, -1008, -911, -820, -734, -654, -580, -511, -447, -388, -335, -286, -242,
+        -203, -168, -137, -110, -87, -67, -51, -37, -26, -18, -11, -6, -3, -1, 0, 0,
+        0, 0, 0, 1, 3, 6, 11, 18, 26, 37, 51, 67, 87, 110, 137, 168,
+        203, 242, 286, 335, 388, 447, 511, 580, 654, 734, 820, 911, 1008, 1111, 1219, 1333,
+        1453, 1579, 1710, 1847, 1989, 2137, 2290, 2447, 2610, 2778, 2950, 3127, 3308, 3492, 3681, 3873,
+        4068, 4266, 4467, 4671, 4876, 5083, 5292, 5502, 5712, 5924, 6135, 6346, 6557, 6767, 6976, 7184,
+        7390, 7593, 7795, 7993, 8189, 8381, 8570, 8755, 8935, 9111, 9283, 9450, 9611, 9767, 9918, 10063,
+        10202, 10335, 10462, 10583, 10697, 10805, 10906, 11001, 11089, 11171, 11246, 11314, 11376, 11432, 11481, 11524,
+        11561, 11592, 11617, 11637, 11651, 11660, 11665, 11664, 11659, 11650, 11638, 11621, 11602, 11580, 11555, 11528,
+        11499, 11469, 11438, 11406, 11375, 11343, 11312, 11282, 11253, 11227, 11202, 11180, 11162, 11146, 11135, 11128,
+        11125, 11128, 11136, 11150, 11169, 11196, 11229, 11269, 11316, 11371, 11433, 11504, 11583, 11671, 11767, 11872,
+        11985, 12108, 12240, 12381, 12531, 12690, 12858, 13036, 13222, 13417, 13621, 13833, 14054, 14283, 14520, 14765,
+        15017, 15276, 15542, 15814, 16092, 16376, 16665, 16958, 17256, 17557, 17861, 18168, 18477, 18787, 19098, 19409,
+        19720, 20029, 20337, 20643, 20945, 21243, 21538, 21826, 22109, 22386, 22655, 22916, 23169, 23412, 23645, 23867,
+        24078, 24276, 24462, 24635, 24793, 24936, 25065, 25177, 25273, 25352, 25413, 25456, 25481, 25487, 25473, 25440,
+        25386, 25312, 25217, 25101, 24963, 24804, 24623, 24420, 24195, 23948, 23678, 23387, 23073, 22737, 22379, 21999,
+        21598, 21175, 20730, 20265, 19779, 19272, 18746, 18200, 17634, 17051, 16449, 15829, 15193, 14540, 13871, 13188,
+        12489, 11777, 11053, 10316, 9567, 8808, 8039, 7261, 6475, 5682, 4882, 4077, 3267, 2453, 1637, 819,
+        0,
+    },
+    {  // level 8, 2 harmonics
+        0, -410, -819, -1228, -1637, -2045, -2452, -2858, -3264, -3668, -4070, -4471, -4871, -5268, -5664, -6058,
+        -6449, -6838, -7224, -7607, -7988, -8366, -8741, -9112, -9480, -9844, -10205, -10562, -10915, -11265, -11609, -11950,
+        -12286, -12618, -12945, -13268, -13585, -13898, -14205, -14507, -14805, -15096, -15382, -15663, -15938, -16208, -16471, -16729,
+        -16980, -17226, -17465, -17699, -17926, -18147, -18361, -18569, -18771, -18966, -19154, -19336, -19511, -19679, -19841, -19996,
+        -20144, -20286, -20420, -20548, -20669, -20783, -20890, -20990, -21084, -21170, -21250, -21323, -21389, -21448, -21500, -21546,
+        -21585, -21617, -21642, -21661, -21673, -21678, -21677, -21669, -21655, -21635, -21608, -21575, -21536, -21490, -21439, -21381,
+        -21318, -21249, -21173, -21093, -21006, -20914, -20816, -20713, -20605, -20492, -20373, -20250, -20121, -19988, -19850, -19708,
+        -19561, -19409, -19253, -19094, -18930, -18762, -18590, -18415, -18236, -18053, -17867, -17678, -17486, -17291, -17092, -16892,
+        -16688, -16482, -16274, -16063, -15850, -15635, -15419, -15200, -14980, -14758, -14535, -14311, -14085, -13859, -13631, -13403,
+        -13174, -12945, -12715, -12485, -12255, -12024, -11794, -11564, -11334, -11104, -10875, -10647, -10419, -10192, -9966, -9741,
+        -9518, -9295, -9074, -8854, -8636, -8419, -8204, -7991, -7780, -7570, -7363, -7158, -6955, -6754, -6556, -6360,
+        -6167, -5976, -5788, -5602, -5419, -5239, -5062, -4888, -4716, -4548, -4383, -4220, -4061, -3905, -3752, -3603,
+        -3456, -3313, -3173, -3036, -2903, -2773, -2646, -2523, -2403, -2286, -2173, -2063, -1956, -1853, -1753, -1656,
+        -1563, -1472, -1385, -1301, -1221, -1143, -1069, -997, -929, -864, -801, -742, -685, -631, -580, -532,
+        -486, -443, -402, -364, -329, -295, -264, -235, -209, -184, -161, -140, -122, -104, -89, -75,
+        -63, -52, -42, -34, -27, -20, -15, -11, -8, -5, -3, -2, -1, 0, 0, 0,
+        0, 0, 0, 0, 1, 2, 3, 5, 8, 11, 15, 20, 27, 34, 42, 52,
+        63, 75, 89, 104, 122, 140, 161, 184, 209, 235, 264, 295, 329, 364, 402, 443,
+        486, 532, 580, 631, 685, 742, 801, 864, 929, 997, 1069, 1143, 1221, 1301, 1385, 1472,
+        1563, 1656, 1753, 1853, 1956, 2063, 2173, 2286, 2403, 2523, 2646, 2773, 2903, 3036, 3173, 3313,
+        3456, 3603, 3752, 3905, 4061, 4220, 4383, 4548, 4716, 4888, 5062, 5239, 5419, 5602, 5788, 5976,
+        6167, 6360, 6556, 6754, 6955, 7158, 7363, 7570, 7780, 7991, 8204, 8419, 8636, 8854, 9074, 9295,
+        9518, 9741, 9966, 10192, 10419, 10647, 10875, 11104, 11334, 11564, 11794, 12024, 12255, 12485, 12715, 12945,
+        13174, 13403, 13631, 13859, 14085, 14311, 14535, 14758, 14980, 15200, 15419, 15635, 15850, 16063, 16274, 16482,
+        16688, 16892, 17092, 17291, 17486, 17678, 17867, 18053, 18236, 18415, 18590, 18762, 18930, 19094, 19253, 19409,
+        19561, 19708, 19850, 19988, 20121, 20250, 20373, 20492, 20605, 20713, 20816, 20914, 21006, 21093, 21173, 21249,
+        21318, 21381, 21439, 21490, 21536, 21575, 21608, 21635, 21655, 21669, 21677, 21678, 21673, 21661, 21642, 21617,
+        21585, 21546, 21500, 21448, 21389, 21323, 21250, 21170, 21084, 20990, 20890, 20783, 20669, 20548, 20420, 20286,
+        20144, 19996, 19841, 19679, 19511, 19336, 19154, 18966, 18771, 18569, 18361, 18147, 17926, 17699, 17465, 17226,
+        16980, 16729, 16471, 16208, 15938, 15663, 15382, 15096, 14805, 14507, 14205, 13898, 13585, 13268, 12945, 12618,
+        12286, 11950, 11609, 11265, 10915, 10562, 10205, 9844, 9480, 9112, 8741, 8366, 7988, 7607, 7224, 6838,
+        6449, 6058, 5664, 5268, 4871, 4471, 4070, 3668, 3264, 2858, 2452, 2045, 1637, 1228, 819, 410,
+        0,
+    },
+    {  // level 9, 1 harmonics
+        0, -205, -410, -614, -819, -1023, -1228, -1432, -1636, -1839, -2043, -2246, -2449, -2651, -2853, -3055,
+        -3256, -3456, -3656, -3856, -4055, -4253, -4451, -4648, -4844, -5040, -5235, -5429, -5622, -5814, -6006, -6197,
+        -6386, -6575, -6763, -6949, -7135, -7320, -7503, -7686, -7867, -8047, -8226, -8403, -8579, -8754, -8928, -9100,
+        -9271, -9441, -9609, -9776, -9941, -10105, -10267, -10428, -10587, -10744, -10900, -11054, -11207, -11358, -11507, -11655,
+        -11800, -11944, -12086, -12227, -12365, -12502, -12636, -12769, -12900, -13029, -13156, -13281, -13404, -13525, -13644, -13761,
+        -13876, -13988, -14099, -14207, -14314, -14418, -14520, -14620, -14718, -14813, -14906, -14997, -15086, -15172, -15256, -15338,
+        -15418, -15495, -15570, -15642, -15713, -15780, -15846, -15909, -15970, -16028, -16084, -16137, -16188, -16237, -16283, -16326,
+        -16367, -16406, -16442, -16476, -16507, -16536, -16563, -16586, -16608, -16627, -16643, -16657, -16668, -16677, -16683, -16687,
+        -16688, -16687, -16683, -16677, -16668, -16657, -16643, -16627, -16608, -16586, -16563, -16536, -16507, -16476, -16442, -16406,
+        -16367, -16326, -16283, -16237, -16188, -16137, -16084, -16028, -15970, -15909, -15846, -15780, -15713, -15642, -15570, -15495,
+        -15418, -15338, -15256, -15172, -15086, -14997, -14906, -14813, -14718, -14620, -14520, -14418, -14314, -14207, -14099, -13988,
+        -13876, -13761, -13644, -13525, -13404, -13281, -13156, -13029, -12900, -12769, -12636, -12502, -12365, -12227, -12086, -11944,
+        -11800, -11655, -11507, -11358, -11207, -11054, -10900, -10744, -10587, -10428, -10267, -10105, -9941, -9776, -9609, -9441,
+        -9271, -9100, -8928, -8754, -8579, -8403, -8226, -8047, -7867, -7686, -7503, -7320, -7135, -6949, -6763, -6575,
+        -6386, -6197, -6006, -5814, -5622, -5429, -5235, -5040, -4844, -4648, -4451, -4253, -4055, -3856, -3656, -3456,
+        -3256, -3055, -2853, -2651, -2449, -2246, -2043, -1839, -1636, -1432, -1228, -1023, -819, -614, -410, -205,
+        0, 205, 410, 614, 819, 1023, 1228, 1432, 1636, 1839, 2043, 2246, 2449, 2651, 2853, 3055,
+        3256, 3456, 3656, 3856, 4055, 4253, 4451, 4648, 4844, 5040, 5235, 5429, 5622, 5814, 6006, 6197,
+        6386, 6575, 6763, 6949, 7135, 7320, 7503, 7686, 7867, 8047, 8226, 8403, 8579, 8754, 8928, 9100,
+        9271, 9441, 9609, 9776, 9941, 10105, 10267, 10428, 10587, 10744, 10900, 11054, 11207, 11358, 11507, 11655,
+        11800, 11944, 12086, 12227, 12365, 12502, 12636, 12769, 12900, 13029, 13156, 13281, 13404, 13525, 13644, 13761,
+        13876, 13988, 14099, 14207, 14314, 14418, 14520, 14620, 14718, 14813, 14906, 14997, 15086, 15172, 15256, 15338,
+        15418, 15495, 15570, 15642, 15713, 15780, 15846, 15909, 15970, 16028, 16084, 16137, 16188, 16237, 16283, 16326,
+        16367, 16406, 16442, 16476, 16507, 16536, 16563, 16586, 16608, 16627, 16643, 16657, 16668, 16677, 16683, 16687,
+        16688, 16687, 16683, 16677, 16668, 16657, 16643, 16627, 16608, 16586, 16563, 16536, 16507, 16476, 16442, 16406,
+        16367, 16326, 16283, 16237, 16188, 16137, 16084, 16028, 15970, 15909, 15846, 15780, 15713, 15642, 15570, 15495,
+        15418, 15338, 15256, 15172, 15086, 14997, 14906, 14813, 14718, 14620, 14520, 14418, 14314, 14207, 14099, 13988,
+        13876, 13761, 13644, 13525, 13404, 13281, 13156, 13029, 12900, 12769, 12636, 12502, 12365, 12227, 12086, 11944,
+        11800, 11655, 11507, 11358, 11207, 11054, 10900, 10744, 10587, 10428, 10267, 10105, 9941, 9776, 9609, 9441,
+        9271, 9100, 8928, 8754, 8579, 8403, 8226, 8047, 7867, 7686, 7503, 7320, 7135, 6949, 6763, 6575,
+        6386, 6197, 6006, 5814, 5622, 5429, 5235, 5040, 4844, 4648, 4451, 4253, 4055, 3856, 3656, 3456,
+        3256, 3055, 2853, 2651, 2449, 2246, 2043, 1839, 1636, 1432, 1228, 1023, 819, 614, 410, 205,
+        0,
+    },
+};
+
+const int16_t kWavetableSquare[kWavetableLevels][kWavetableSize + 1] PROGMEM = {
+    {  // level 0, 170 harmonics
+        0, 27419, 28771, 23666, 26936, 27179, 24902, 26655, 26815, 25334, 26521, 26658, 25552, 26443, 26570, 25684,
+        26392, 26515, 25773, 26357, 26477, 25836, 26330, 26449, 25883, 26310, 26428, 25920, 26294, 26411, 25950, 26280,
+        26397, 25974, 26269, 26386, 25995, 26260, 26377, 26012, 26252, 26369, 26027, 26245, 26362, 26040, 26239, 26356,
+        26051, 26233, 26351, 26061, 26228, 26347, 26070, 26224, 26343, 26078, 26220, 26339, 26085, 26216, 26336, 26092,
+        26213, 26333, 26098, 26210, 26331, 26103, 26207, 26328, 26108, 26204, 26326, 26113, 26201, 26325, 26117, 26199,
+        26323, 26122, 26196, 26321, 26125, 26194, 26320, 26129, 26192, 26319, 26132, 26189, 26318, 26136, 26187, 26317,
+        26139, 26185, 26316, 26142, 26183, 26315, 26144, 26181, 26314, 26147, 26179, 26314, 26150, 26177, 26313, 26152,
+        26175, 26313, 26154, 26173, 26312, 26157, 26171, 26312, 26159, 26169, 26312, 26161, 26167, 26312, 26163, 26165,
+        26312, 26165, 26163, 26312, 26167, 26161, 26312, 26169, 26159, 26312, 26171, 26157, 26312, 26173, 26154, 26313,
+        26175, 26152, 26313, 26177, 26150, 26314, 26179, 26147, 26314, 26181, 26144, 26315, 26183, 26142, 26316, 26185,
+        26139, 26317, 26187, 26136, 26318, 26189, 26132, 26319, 26192, 26129, 26320, 26194, 26125, 26321, 26196, 26122,
+        26323, 26199, 26117, 26325, 26201, 26113, 26326, 26204, 26108, 26328, 26207, 26103, 26331, 26210, 26098, 26333,
+        26213, 26092, 26336, 26216, 26085, 26339, 26220, 26078, 26343, 26224, 26070, 26347, 26228, 26061, 26351, 26233,
+        26051, 26356, 26239, 26040, 26362, 26245, 26027, 26369, 26252, 26012, 26377, 26260, 25995, 26386, 26269, 25974,
+        26397, 26280, 25950, 26411, 26294, 25920, 26428, 26310, 25883, 26449, 26330, 25836, 26477, 26357, 25773, 26515,
+        26392, 25684, 26570, 26443, 25552, 26658, 26521, 25334, 26815, 26655, 24902, 27179, 26936, 23666, 28771, 27419,
+        0, -27419, -28771, -23666, -26936, -27179, -24902, -26655, -26815, -25334, -26521, -26658, -25552, -26443, -26570, -25684,
+        -26392, -26515, -25773, -26357, -26477, -25836, -26330, -26449, -25883, -26310, -26428, -25920, -26294, -26411, -25950, -26280,
+        -26397, -25974, -26269, -26386, -25995, -26260, -26377, -26012, -26252, -26369, -26027, -26245, -26362, -26040, -26239, -26356,
+        -26051, -26233, -26351, -26061, -26228, -26347, -26070, -26224, -26343, -26078, -26220, -26339, -26085, -26216, -26336, -26092,
+        -26213, -26333, -26098, -26210, -26331, -26103, -26207, -26328, -26108, -26204, -26326, -26113, -26201, -26325, -26117, -26199,
+        -26323, -26122, -26196, -26321, -26125, -26194, -26320, -26129, -26192, -26319, -26132, -26189, -26318, -26136, -26187, -26317,
+        -26139, -26185, -26316, -26142, -26183, -26315, -26144, -26181, -26314, -26147, -26179, -26314, -26150, -26177, -26313, -26152,
+        -26175, -26313, -26154, -26173, -26312, -26157, -26171, -26312, -26159, -26169, -26312, -26161, -26167, -26312, -26163, -26165,
+        -26312, -26165, -26163, -26312, -26167, -26161, -26312, -26169, -26159, -26312, -26171, -26157, -26312, -26173, -26154, -26313,
+        -26175, -26152, -26313, -26177, -26150, -26314, -26179, -26147, -26314, -26181, -26144, -26315, -26183, -26142, -26316, -26185,
+        -26139, -26317, -26187, -26136, -26318, -26189, -26132, -26319, -26192, -26129, -26320, -26194, -26125, -26321, -26196, -26122,
+        -26323, -26199, -26117, -26325, -26201, -26113, -26326, -26204, -26108, -26328, -26207, -26103, -26331, -26210, -26098, -26333,
+        -26213, -26092, -26336, -26216, -26085, -26339, -26220, -26078, -26343, -26224, -26070, -26347, -26228, -26061, -26351, -26233,
+        -26051, -26356, -26239, -26040, -26362, -26245, -26027, -26369, -26252, -26012, -26377, -26260, -25995, -26386, -26269, -25974,
+        -26397, -26280, -25950, -26411, -26294, -25920, -26428, -26310, -25883, -26449, -26330, -25836, -26477, -26357, -25773, -26515,
+        -26392, -25684, -26570, -26443, -25552, -26658, -26521, -25334, -26815, -26655, -24902, -27179, -26936, -23666, -28771, -27419,
+        0,
+    },
+    {  // level 1, 170 harmonics
+        0, 27419, 28771, 23666, 26936, 27179, 24902, 26655, 26815, 25334, 26521, 26658, 25552, 26443, 26570, 25684,
+        26392, 26515, 25773, 26357, 26477, 25836, 26330, 26449, 25883, 26310, 26428, 25920, 26294, 26411, 25950, 26280,
+        26397, 25974, 26269, 26386, 25995, 26260, 26377, 26012, 26252, 26369, 26027, 26245, 26362, 26040, 26239, 26356,
+        26051, 26233, 26351, 26061, 26228, 26347, 26070, 26224, 26343, 26078, 26220, 26339, 26085, 26216, 26336, 26092,
+        26213, 26333, 26098, 26210, 26331, 26103, 26207, 26328, 26108, 26204, 26326, 26113, 26201, 26325, 26117, 26199,
+        26323, 26122, 26196, 26321, 26125, 26194, 26320, 26129, 26192, 26319, 26132, 26189, 26318, 26136, 26187, 26317,
+        26139, 26185, 26316, 26142, 26183, 26315, 26144, 26181, 26314, 26147, 26179, 26314, 26150, 26177, 26313, 26152,
+        26175, 26313, 26154, 26173, 26312, 26157, 26171, 26312, 26159, 26169, 26312, 26161, 26167, 26312, 26163, 26165,
+        26312, 26165, 26163, 26312, 26167, 26161, 26312, 26169, 26159, 26312, 26171, 26157, 26312, 26173, 26154, 26313,
+        26175, 26152, 26313, 26177, 26150, 26314, 26179, 26147, 26314, 26181, 26144, 26315, 26183, 26142, 26316, 26185,
+        26139, 26317, 26187, 26136, 26318, 26189, 26132, 26319, 26192, 26129, 26320, 26194, 26125, 26321, 26196, 26122,
+        26323, 26199, 26117, 26325, 26201, 26113, 26326, 26204, 26108, 26328, 26207, 26103, 26331, 26210, 26098, 26333,
+        26213, 26092, 26336, 26216, 26085, 26339, 26220, 26078, 26343, 26224, 26070, 26347, 26228, 26061, 26351, 26233,
+        26051, 26356, 26239, 26040, 26362, 26245, 26027, 26369, 26252, 26012, 26377, 26260, 25995, 26386, 26269, 25974,
+        26397, 26280, 25950, 26411, 26294, 25920, 26428, 26310, 25883, 26449, 26330, 25836, 26477, 26357, 25773, 26515,
+        26392, 25684, 26570, 26443, 25552, 26658, 26521, 25334, 26815, 26655, 24902, 27179, 26936, 23666, 28771, 27419,
+        0, -27419, -28771, -23666, -26936, -27179, -24902, -26655, -26815, -25334, -26521, -26658, -25552, -26443, -26570, -25684,
+        -26392, -26515, -25773, -26357, -26477, -25836, -26330, -26449, -25883, -26310, -26428, -25920, -26294, -26411, -25950, -26280,
+        -26397, -25974, -26269, -26386, -25995, -26260, -26377, -26012, -26252, -26369, -26027, -26245, -26362, -26040, -26239, -26356,
+        -26051, -26233, -26351, -26061, -26228, -26347, -26070, -26224, -26343, -26078, -26220, -26339, -26085, -26216, -26336, -26092,
+        -26213, -26333, -26098, -26210, -26331, -26103, -26207, -26328, -26108, -26204, -26326, -26113, -26201, -26325, -26117, -26199,
+        -26323, -26122, -26196, -26321, -26125, -26194, -26320, -26129, -26192, -26319, -26132, -26189, -26318, -26136, -26187, -26317,
+        -26139, -26185, -26316, -26142, -26183, -26315, -26144, -26181, -26314, -26147, -26179, -26314, -26150, -26177, -26313, -26152,
+        -26175, -26313, -26154, -26173, -26312, -26157, -26171, -26312, -26159, -26169, -26312, -26161, -26167, -26312, -26163, -26165,
+        -26312, -26165, -26163, -26312, -26167, -26161, -26312, -26169, -26159, -26312, -26171, -26157, -26312, -26173, -26154, -26313,
+        -26175, -26152, -26313, -26177, -26150, -26314, -26179, -26147, -26314, -26181, -26144, -26315, -26183, -26142, -26316, -26185,
+        -26139, -26317, -26187, -26136, -26318, -26189, -26132, -26319, -26192, -26129, -26320, -26194, -26125, -26321, -26196, -26122,
+        -26323, -26199, -26117, -26325, -26201, -26113, -26326, -26204, -26108, -26328, -26207, -26103, -26331, -26210, -26098, -26333,
+        -26213, -26092, -26336, -26216, -26085, -26339, -26220, -26078, -26343, -26224, -26070, -26347, -26228, -26061, -26351, -26233,
+        -26051, -26356, -26239, -26040, -26362, -26245, -26027, -26369, -26252, -26012, -26377, -26260, -25995, -26386, -26269, -25974,
+        -26397, -26280, -25950, -26411, -26294, -25920, -26428, -26310, -25883, -26449, -26330, -25836, -26477, -26357, -25773, -26515,
+        -26392, -25684, -26570, -26443, -25552, -26658, -26521, -25334, -26815, -26655, -24902, -27179, -26936, -23666, -28771, -27419,
+        0,
+    },
+    {  // level 2, 128 harmonics
+        0, 22876, 30906, 26841, 23665, 25964, 27950, 26345, 24899, 26133, 27270, 26268, 25330, 26174, 26973, 26243,
+        25547, 26191, 26807, 26232, 25678, 26199, 26702, 26226, 25765, 26203, 26629, 26223, 25827, 26206, 26576, 26220,
+        25873, 26208, 26535, 26219, 25909, 26209, 26503, 26218, 25937, 26210, 26478, 26217, 25960, 26210, 26457, 26216,
+        25979, 26211, 26440, 26216, 25995, 26211, 26425, 26216, 26008, 26212, 26413, 26215, 26020, 26212, 26403, 26215,
+        26029, 26212, 26394, 26215, 26038, 26212, 26386, 26215, 26045, 26213, 26379, 26215, 26051, 26213, 26373, 26214,
+        26057, 26213, 26368, 26214, 26062, 26213, 26363, 26214, 26066, 26213, 26360, 26214, 26069, 26213, 26356, 26214,
+        26072, 26213, 26353, 26214, 26075, 26213, 26351, 26214, 26077, 26213, 26349, 26214, 26079, 26213, 26347, 26214,
+        26081, 26213, 26346, 26214, 26082, 26213, 26345, 26214, 26083, 26214, 26344, 26214, 26083, 26214, 26344, 26214,
+        26083, 26214, 26344, 26214, 26083, 26214, 26344, 26214, 26083, 26214, 26345, 26213, 26082, 26214, 26346, 26213,
+        26081, 26214, 26347, 26213, 26079, 26214, 26349, 26213, 26077, 26214, 26351, 26213, 26075, 26214, 26353, 26213,
+        26072, 26214, 26356, 26213, 26069, 26214, 26360, 26213, 26066, 26214, 26363, 26213, 26062, 26214, 26368, 26213,
+        26057, 26214, 26373, 26213, 26051, 26215, 26379, 26213, 26045, 26215, 26386, 26212, 26038, 26215, 26394, 26212,
+        26029, 26215, 26403, 26212, 26020, 26215, 26413, 26212, 26008, 26216, 26425, 26211, 25995, 26216, 26440, 26211,
+        25979, 26216, 26457, 26210, 25960, 26217, 26478, 26210, 25937, 26218, 26503, 26209, 25909, 26219, 26535, 26208,
+        25873, 26220, 26576, 26206, 25827, 26223, 26629, 26203, 25765, 26226, 26702, 26199, 25678, 26232, 26807, 26191,
+        25547, 26243, 26973, 26174, 25330, 26268, 27270, 26133, 24899, 26345, 27950, 25964, 23665, 26841, 30906, 22876,
+        0, -22876, -30906, -26841, -23665, -25964, -27950, -26345, -24899, -26133, -27270, -26268, -25330, -26174, -26973, -26243,
+        -25547, -26191, -26807, -26232, -25678, -26199, -26702, -26226, -25765, -26203, -26629, -26223, -25827, -26206, -26576, -26220,
+        -25873, -26208, -26535, -26219, -25909, -26209, -26503, -26218, -25937, -26210, -26478, -26217, -25960, -26210, -26457, -26216,
+        -25979, -26211, -26440, -26216, -25995, -26211, -26425, -26216, -26008, -26212, -26413, -26215, -26020, -26212, -26403, -26215,
+        -26029, -26212, -26394, -26215, -26038, -26212, -26386, -26215, -26045, -26213, -26379, -26215, -26051, -26213, -26373, -26214,
+        -26057, -26213, -26368, -26214, -26062, -26213, -26363, -26214, -26066, -26213, -26360, -26214, -26069, -26213, -26356, -26214,
+        -26072, -26213, -26353, -26214, -26075, -26213, -26351, -26214, -26077, -26213, -26349, -26214, -26079, -26213, -26347, -26214,
+        -26081, -26213, -26346, -26214, -26082, -26213, -26345, -26214, -26083, -26214, -26344, -26214, -26083, -26214, -26344, -26214,
+        -26083, -26214, -26344, -26214, -26083, -26214, -26344, -26214, -26083, -26214, -26345, -26213, -26082, -26214, -26346, -26213,
+        -26081, -26214, -26347, -26213, -26079, -26214, -26349, -26213, -26077, -26214, -26351, -26213, -26075, -26214, -26353, -26213,
+        -26072, -26214, -26356, -26213, -26069, -26214, -26360, -26213, -26066, -26214, -26363, -26213, -26062, -26214, -26368, -26213,
+        -26057, -26214, -26373, -26213, -26051, -26215, -26379, -26213, -26045, -26215, -26386, -26212, -26038, -26215, -26394, -26212,
+        -26029, -26215, -26403, -26212, -26020, -26215, -26413, -26212, -26008, -26216, -26425, -26211, -25995, -26216, -26440, -26211,
+        -25979, -26216, -26457, -26210, -25960, -26217, -26478, -26210, -25937, -26218, -26503, -26209, -25909, -26219, -26535, -26208,
+        -25873, -26220, -26576, -26206, -25827, -26223, -26629, -26203, -25765, -26226, -26702, -26199, -25678, -26232, -26807, -26191,
+        -25547, -26243, -26973, -26174, -25330, -26268, -27270, -26133, -24899, -26345, -27950, -25964, -23665, -26841, -30906, -22876,
+        0,
+    },
+    {  // level 3, 64 harmonics
+        0, 12666, 22876, 29035, 30907, 29568, 26840, 24512, 23662, 24383, 25965, 27404, 27955, 27461, 26345, 25301,
+        24893, 25269, 26133, 26954, 27279, 26974, 26268, 25591, 25320, 25576, 26175, 26753, 26985, 26763, 26243, 25738,
+        25534, 25730, 26191, 26640, 26822, 26646, 26231, 25826, 25662, 25821, 26199, 26569, 26720, 26573, 26226, 25884,
+        25745, 25881, 26204, 26521, 26651, 26524, 26222, 25925, 25803, 25922, 26206, 26487, 26602, 26489, 26220, 25954,
+        25845, 25952, 26208, 26461, 26565, 26463, 26218, 25976, 25876, 25975, 26210, 26442, 26538, 26444, 26217, 25992,
+        25900, 25992, 26211, 26428, 26517, 26429, 26216, 26005, 25918, 26004, 26211, 26417, 26502, 26418, 26216, 26014,
+        25931, 26014, 26212, 26409, 26490, 26410, 26215, 26021, 25941, 26021, 26212, 26403, 26482, 26404, 26215, 26026,
+        25948, 26026, 26213, 26400, 26477, 26400, 26214, 26028, 25952, 26028, 26213, 26398, 26475, 26398, 26214, 26029,
+        25953, 26029, 26214, 26398, 26475, 26398, 26213, 26028, 25952, 26028, 26214, 26400, 26477, 26400, 26213, 26026,
+        25948, 26026, 26215, 26404, 26482, 26403, 26212, 26021, 25941, 26021, 26215, 26410, 26490, 26409, 26212, 26014,
+        25931, 26014, 26216, 26418, 26502, 26417, 26211, 26004, 25918, 26005, 26216, 26429, 26517, 26428, 26211, 25992,
+        25900, 25992, 26217, 26444, 26538, 26442, 26210, 25975, 25876, 25976, 26218, 26463, 26565, 26461, 26208, 25952,
+        25845, 25954, 26220, 26489, 26602, 26487, 26206, 25922, 25803, 25925, 26222, 26524, 26651, 26521, 26204, 25881,
+        25745, 25884, 26226, 26573, 26720, 26569, 26199, 25821, 25662, 25826, 26231, 26646, 26822, 26640, 26191, 25730,
+        25534, 25738, 26243, 26763, 26985, 26753, 26175, 25576, 25320, 25591, 26268, 26974, 27279, 26954, 26133, 25269,
+        24893, 25301, 26345, 27461, 27955, 27404, 25965, 24383, 23662, 24512, 26840, 29568, 30907, 29035, 22876, 12666,
+        0, -12666, -22876, -29035, -30907, -29568, -26840, -24512, -23662, -24383, -25965, -27404, -27955, -27461, -26345, -25301,
+        -24893, -25269, -26133, -26954, -27279, -26974, -26268, -25591, -25320, -25576, -26175, -26753, -26985, -26763, -26243, -25738,
+        -25534, -25730, -26191, -26640, -26822, -26646, -26231, -25826, -25662, -25821, -26199, -26569, -26720, -26573, -26226, -25884,
+        -25745, -25881, -26204, -26521, -26651, -26524, -26222, -25925, -25803, -25922, -26206, -26487, -26602, -26489, -26220, -25954,
+        -25845, -25952, -26208, -26461, -26565, -26463, -26218, -25976, -25876, -25975, -26210, -26442, -26538, -26444, -26217, -25992,
+        -25900, -25992, -26211, -26428, -26517, -26429, -26216, -26005, -25918, -26004, -26211, -26417, -26502, -26418, -26216, -26014,
+        -25931, -26014, -26212, -26409, -26490, -26410, -26215, -26021, -25941, -26021, -26212, -26403, -26482, -26404, -26215, -26026,
+        -25948, -26026, -26213, -26400, -26477, -26400, -26214, -26028, -25952, -26028, -26213, -26398, -26475, -26398, -26214, -26029,
+        -25953, -26029, -26214, -26398, -26475, -26398, -26213, -26028, -25952, -26028, -26214, -26400, -26477, -26400, -26213, -26026,
+        -25948, -26026, -26215, -26404, -26482, -26403, -26212, -26021, -25941, -26021, -26215, -26410, -26490, -26409, -26212, -26014,
+        -25931, -26014, -26216, -26418, -26502, -26417, -26211, -26004, -25918, -26005, -26216, -26429, -26517, -26428, -26211, -25992,
+        -25900, -25992, -26217, -26444, -26538, -26442, -26210, -25975, -25876, -25976, -26218, -26463, -26565, -26461, -26208, -25952,
+        -25845, -25954, -26220, -26489, -26602, -26487, -26206, -25922, -25803, -25925, -26222, -26524, -26651, -26521, -26204, -25881,
+        -25745, -25884, -26226, -26573, -26720, -26569, -26199, -25821, -25662, -25826, -26231, -26646, -26822, -26640, -26191, -25730,
+        -25534, -25738, -26243, -26763, -26985, -26753, -26175, -25576, -25320, -25591, -26268, -26974, -27279, -26954, -26133, -25269,
+        -24893, -25301, -26345, -27461, -27955, -27404, -25965, -24383, -23662, -24512, -26840, -29568, -30907, -29035, -22876, -12666,
+        0,
+    },
+    {  // level 4, 32 harmonics
+        0, 6498, 12666, 18207, 22878, 26514, 29040, 30472, 30914, 30540, 29572, 28257, 26838, 25530, 24502, 23861,
+        23649, 23845, 24374, 25125, 25967, 26769, 27418, 27834, 27974, 27841, 27475, 26945, 26343, 25760, 25282, 24972,
+        24867, 24968, 25251, 25662, 26135, 26596, 26977, 27226, 27312, 27229, 26997, 26658, 26265, 25881, 25562, 25352,
+        25280, 25350, 25548, 25839, 26177, 26510, 26787, 26969, 27033, 26971, 26796, 26539, 26240, 25945, 25698, 25535,
+        25478, 25534, 25691, 25923, 26194, 26462, 26686, 26835, 26887, 26836, 26692, 26478, 26229, 25981, 25773, 25636,
+        25588, 25635, 25769, 25969, 26202, 26434, 26629, 26759, 26804, 26759, 26632, 26443, 26222, 26002, 25816, 25693,
+        25650, 25693, 25814, 25995, 26207, 26419, 26598, 26716, 26758, 26717, 26599, 26424, 26218, 26012, 25839, 25723,
+        25682, 25723, 25838, 26009, 26211, 26413, 26583, 26697, 26737, 26697, 26584, 26414, 26214, 26015, 25845, 25732,
+        25693, 25732, 25845, 26015, 26214, 26414, 26584, 26697, 26737, 26697, 26583, 26413, 26211, 26009, 25838, 25723,
+        25682, 25723, 25839, 26012, 26218, 26424, 26599, 26717, 26758, 26716, 26598, 26419, 26207, 25995, 25814, 25693,
+        25650, 25693, 25816, 26002, 26222, 26443, 26632, 26759, 26804, 26759, 26629, 26434, 26202, 25969, 25769, 25635,
+        25588, 25636, 25773, 25981, 26229, 26478, 26692, 26836, 26887, 26835, 26686, 26462, 26194, 25923, 25691, 25534,
+        25478, 25535, 25698, 25945, 26240, 26539, 26796, 26971, 27033, 26969, 26787, 26510, 26177, 25839, 25548, 25350,
+        25280, 25352, 25562, 25881, 26265, 26658, 26997, 27229, 27312, 27226, 26977, 26596, 26135, 25662, 25251, 24968,
+        24867, 24972, 25282, 25760, 26343, 26945, 27475, 27841, 27974, 27834, 27418, 26769, 25967, 25125, 24374, 23845,
+        23649, 23861, 24502, 25530, 26838, 28257, 29572, 30540, 30914, 30472, 29040, 26514, 22878, 18207, 12666, 6498,
+        0, -6498, -12666, -18207, -22878, -26514, -29040, -30472, -30914, -30540, -29572, -28257, -26838, -25530, -24502, -23861,
+        -23649, -23845, -24374, -25125, -25967, -26769, -27418, -27834, -27974, -27841, -27475, -26945, -26343, -25760, -25282, -24972,
+        -24867, -24968, -25251, -25662, -26135, -26596, -26977, -27226, -27312, -27229, -26997, -26658, -26265, -25881, -25562, -25352,
+        -25280, -25350, -25548, -25839, -26177, -26510, -26787, -26969, -27033, -26971, -26796, -26539, -26240, -25945, -25698, -25535,
+        -25478, -25534, -25691, -25923, -26194, -26462, -26686, -26835, -26887, -26836, -26692, -26478, -26229, -25981, -25773, -25636,
+        -25588, -25635, -25769, -25969, -26202, -26434, -26629, -26759, -26804, -26759, -26632, -26443, -26222, -26002, -25816, -25693,
+        -25650, -25693, -25814, -25995, -26207, -26419, -26598, -26716, -26758, -26717, -26599, -26424, -26218, -26012, -25839, -25723,
+        -25682, -25723, -25838, -26009, -26211, -26413, -26583, -26697, -26737, -26697, -26584, -26414, -26214, -26015, -25845, -25732,
+        -25693, -25732, -25845, -26015, -26214, -26414, -26584, -26697, -26737, -26697, -26583, -26413, -26211, -26009, -25838, -25723,
+        -25682, -25723, -25839, -26012, -26218, -26424, -26599, -26717, -26758, -26716, -26598, -26419, -26207, -25995, -25814, -25693,
+        -25650, -25693, -25816, -26002, -26222, -26443, -26632, -26759, -26804, -26759, -26629, -26434, -26202, -25969, -25769, -25635,
+        -25588, -25636, -25773, -25981, -26229, -26478, -26692, -26836, -26887, -26835, -26686, -26462, -26194, -25923, -25691, -25534,
+        -25478, -25535, -25698, -25945, -26240, -26539, -26796, -26971, -27033, -26969, -26787, -26510, -26177, -25839, -25548, -25350,
+        -25280, -25352, -25562, -25881, -26265, -26658, -26997, -27229, -27312, -27226, -26977, -26596, -26135, -25662, -25251, -24968,
+        -24867, -24972, -25282, -25760, -26343, -26945, -27475, -27841, -27974, -27834, -27418, -26769, -25967, -25125, -24374, -23845,
+        -23649, -23861, -24502, -25530, -26838, -28257, -29572, -30540, -30914, -30472, -29040, -26514, -22878, -18207, -12666, -6498,
+        0,
+    },
+    {  // level 5, 16 harmonics
+        0, 3270, 6498, 9643, 12668, 15534, 18211, 20670, 22886, 24843, 26528, 27933, 29059, 29910, 30496, 30832,
+        30939, 30841, 30563, 30135, 29589, 28954, 28263, 27545, 26830, 26142, 25507, 24942, 24464, 24085, 23813, 23650,
+        23597, 23648, 23797, 24031, 24338, 24703, 25109, 25539, 25976, 26402, 26804, 27166, 27477, 27726, 27908, 28018,
+        28055, 28019, 27915, 27750, 27530, 27267, 26972, 26656, 26333, 26014, 25713, 25439, 25202, 25010, 24869, 24783,
+        24755, 24783, 24865, 24998, 25174, 25386, 25625, 25882, 26147, 26409, 26658, 26886, 27083, 27244, 27363, 27435,
+        27459, 27435, 27365, 27251, 27099, 26916, 26708, 26484, 26252, 26022, 25802, 25601, 25426, 25283, 25177, 25112,
+        25090, 25112, 25176, 25279, 25417, 25584, 25775, 25980, 26193, 26406, 26609, 26796, 26959, 27092, 27191, 27252,
+        27273, 27252, 27192, 27094, 26963, 26803, 26622, 26425, 26220, 26016, 25819, 25639, 25480, 25350, 25254, 25195,
+        25175, 25195, 25254, 25350, 25480, 25639, 25819, 26016, 26220, 26425, 26622, 26803, 26963, 27094, 27192, 27252,
+        27273, 27252, 27191, 27092, 26959, 26796, 26609, 26406, 26193, 25980, 25775, 25584, 25417, 25279, 25176, 25112,
+        25090, 25112, 25177, 25283, 25426, 25601, 25802, 26022, 26252, 26484, 26708, 26916, 27099, 27251, 27365, 27435,
+        27459, 27435, 27363, 27244, 27083, 26886, 26658, 26409, 26147, 25882, 25625, 25386, 25174, 24998, 24865, 24783,
+        24755, 24783, 24869, 25010, 25202, 25439, 25713, 26014, 26333, 26656, 26972, 27267, 27530, 27750, 27915, 28019,
+        28055, 28018, 27908, 27726, 27477, 27166, 26804, 26402, 25976, 25539, 25109, 24703, 24338, 24031, 23797, 23648,
+        23597, 23650, 23813, 24085, 24464, 24942, 25507, 26142, 26830, 27545, 28263, 28954, 29589, 30135, 30563, 30841,
+        30939, 30832, 30496, 29910, 29059, 27933, 26528, 24843, 22886, 20670, 18211, 15534, 12668, 9643, 6498, 3270,
+        0, -3270, -6498, -9643, -12668, -15534, -18211, -20670, -22886, -24843, -26528, -27933, -29059, -29910, -30496, -30832,
+        -30939, -30841, -30563, -30135, -29589, -28954, -28263, -27545, -26830, -26142, -25507, -24942, -24464, -24085, -23813, -23650,
+        -23597, -23648, -23797, -24031, -24338, -24703, -25109, -25539, -25976, -26402, -26804, -27166, -27477, -27726, -27908, -28018,
+        -28055, -28019, -27915, -27750, -27530, -27267, -26972, -26656, -26333, -26014, -25713, -25439, -25202, -25010, -24869, -24783,
+        -24755, -24783, -24865, -24998, -25174, -25386, -25625, -25882, -26147, -26409, -26658, -26886, -27083, -27244, -27363, -27435,
+        -27459, -27435, -27365, -27251, -27099, -26916, -26708, -26484, -26252, -26022, -25802, -25601, -25426, -25283, -25177, -25112,
+        -25090, -25112, -25176, -25279, -25417, -25584, -25775, -25980, -26193, -26406, -26609, -26796, -26959, -27092, -27191, -27252,
+        -27273, -27252, -27192, -27094, -26963, -26803, -26622, -26425, -26220, -26016, -25819, -25639, -25480, -25350, -25254, -25195,
+        -25175, -25195, -25254, -25350, -25480, -25639, -25819, -26016, -26220, -26425, -26622, -26803, -26963, -27094, -27192, -27252,
+        -27273, -27252, -27191, -27092, -26959, -26796, -26609, -26406, -26193, -25980, -25775, -25584, -25417, -25279, -25176, -25112,
+        -25090, -25112, -25177, -25283, -25426, -25601, -25802, -26022, -26252, -26484, -26708, -26916, -27099, -27251, -27365, -27435,
+        -27459, -27435, -27363, -27244, -27083, -26886, -26658, -26409, -26147, -25882, -25625, -25386, -25174, -24998, -24865, -24783,
+        -24755, -24783, -24869, -25010, -25202, -25439, -25713, -26014, -26333, -26656, -26972, -27267, -27530, -27750, -27915, -28019,
+        -28055, -28018, -27908, -27726, -27477, -27166, -26804, -26402, -25976, -25539, -25109, -24703, -24338, -24031, -23797, -23648,
+        -23597, -23650, -23813, -24085, -24464, -24942, -25507, -26142, -26830, -27545, -28263, -28954, -29589, -30135, -30563, -30841,
+        -30939, -30832, -30496, -29910, -29059, -27933, -26528, -24843, -22886, -20670, -18211, -15534, -12668, -9643, -6498, -3270,
+        0,
+    },
+    {  // level 6, 8 harmonics
+        0, 1637, 3270, 4892, 6498, 8085, 9645, 11176, 12672, 14130, 15544, 16910, 18227, 19488, 20693, 21837,
+        22919, 23936, 24887, 25769, 26583, 27326, 28000, 28603, 29137, 29601, 29998, 30327, 30592, 30793, 30934, 31016,
+        31043, 31017, 30942, 30821, 30658, 30456, 30219, 29951, 29656, 29338, 29001, 28648, 28285, 27913, 27539, 27164,
+        26792, 26428, 26073, 25731, 25405, 25096, 24809, 24544, 24303, 24087, 23899, 23739, 23608, 23506, 23433, 23390,
+        23376, 23390, 23432, 23500, 23593, 23711, 23851, 24011, 24189, 24385, 24594, 24816, 25047, 25286, 25530, 25777,
+        26024, 26269, 26509, 26743, 26969, 27184, 27386, 27575, 27747, 27903, 28040, 28157, 28254, 28330, 28385, 28418,
+        28429, 28418, 28386, 28332, 28259, 28166, 28055, 27927, 27783, 27625, 27454, 27272, 27081, 26883, 26679, 26472,
+        26263, 26055, 25849, 25648, 25452, 25266, 25088, 24923, 24770, 24632, 24510, 24405, 24317, 24248, 24198, 24168,
+        24158, 24168, 24198, 24248, 24317, 24405, 24510, 24632, 24770, 24923, 25088, 25266, 25452, 25648, 25849, 26055,
+        26263, 26472, 26679, 26883, 27081, 27272, 27454, 27625, 27783, 27927, 28055, 28166, 28259, 28332, 28386, 28418,
+        28429, 28418, 28385, 28330, 28254, 28157, 28040, 27903, 27747, 27575, 27386, 27184, 26969, 26743, 26509, 26269,
+        26024, 25777, 25530, 25286, 25047, 24816, 24594, 24385, 24189, 24011, 23851, 23711, 23593, 23500, 23432, 23390,
+        23376, 23390, 23433, 23506, 23608, 23739, 23899, 24087, 24303, 24544, 24809, 25096, 25405, 25731, 26073, 26428,
+        26792, 27164, 27539, 27913, 28285, 28648, 29001, 29338, 29656, 29951, 30219, 30456, 30658, 30821, 30942, 31017,
+        31043, 31016, 30934, 30793, 30592, 30327, 29998, 29601, 29137, 28603, 28000, 27326, 26583, 25769, 24887, 23936,
+        22919, 21837, 20693, 19488, 18227, 16910, 15544, 14130, 12672, 11176, 9645, 8085, 6498, 4892, 3270, 1637,
+        0, -1637, -3270, -4892, -6498, -8085, -9645, -11176, -12672, -14130, -15544, -16910, -18227, -19488, -20693, -21837,
+        -22919, -23936, -24887, -25769, -26583, -27326, -28000, -28603, -29137, -29601, -29998, -30327, -30592, -30793, -30934, -31016,
+        -31043, -31017, -30942, -30821, -30658, -30456, -30219, -29951, -29656, -29338, -29001, -28648, -28285, -27913, -27539, -27164,
+        -26792, -26428, -26073, -25731, -25405, -25096, -24809, -24544, -24303, -24087, -23899, -23739, -23608, -23506, -23433, -23390,
+        -23376, -23390, -23432, -23500, -23593, -23711, -23851, -24011, -24189, -24385, -24594, -24816, -25047, -25286, -25530, -25777,
+        -26024, -26269, -26509, -26743, -26969, -27184, -27386, -27575, -27747, -27903, -28040, -28157, -28254, -28330, -28385, -28418,
+        -28429, -28418, -28386, -28332, -28259, -28166, -28055, -27927, -27783, -27625, -27454, -27272, -27081, -26883, -26679, -26472,
+        -26263, -26055, -25849, -25648, -25452, -25266, -25088, -24923, -24770, -24632, -24510, -24405, -24317, -24248, -24198, -24168,
+        -24158, -24168, -24198, -24248, -24317, -24405, -24510, -24632, -24770, -24923, -25088, -25266, -25452, -25648, -25849, -26055,
+        -26263, -26472, -26679, -26883, -27081, -27272, -27454, -27625, -27783, -27927, -28055, -28166, -28259, -28332, -28386, -28418,
+        -28429, -28418, -28385, -28330, -28254, -28157, -28040, -27903, -27747, -27575, -27386, -27184, -26969, -26743, -26509, -26269,
+        -26024, -25777, -25530, -25286, -25047, -24816, -24594, -24385, -24189, -24011, -23851, -23711, -23593, -23500, -23432, -23390,
+        -23376, -23390, -23433, -23506, -23608, -23739, -23899, -24087, -24303, -24544, -24809, -25096, -25405, -25731, -26073, -26428,
+        -26792, -27164, -27539, -27913, -28285, -28648, -29001, -29338, -29656, -29951, -30219, -30456, -30658, -30821, -30942, -31017,
+        -31043, -31016, -30934, -30793, -30592, -30327, -29998, -29601, -29137, -28603, -28000, -27326, -26583, -25769, -24887, -23936,
+        -22919, -21837, -20693, -19488, -18227, -16910, -15544, -14130, -12672, -11176, -9645, -8085, -6498, -4892, -3270, -1637,
+        0,
+    },
+    {  // level 7, 4 harmonics
+        0, 819, 1638, 2455, 3270, 4083, 4893, 5699, 6501, 7298, 8090, 8875, 9654, 10426, 11190, 11945,
+        12692, 13430, 14157, 14875, 15581, 16276, 16959, 17630, 18289, 18934, 19565, 20183, 20787, 21376, 21949, 22508,
+        23051, 23578, 24089, 24584, 25062, 25524, 25968, 26395, 26805, 27198, 27573, 27931, 28271, 28593, 28898, 29185,
+        29454, 29706, 29941, 30158, 30357, 30540, 30705, 30854, 30985, 31101, 31200, 31283, 31350, 31402, 31438, 31460,
+        31467, 31460, 31439, 31405, 31358, 31297, 31225, 31140, 31045, 30938, 30820, 30693, 30556, 30410, 30255, 30092,
+        29922, 29744, 29560, 29370, 29174, 28973, 28767, 28558, 28345, 28129, 27910, 27690, 27468, 27246, 27023, 26800,
+        26578, 26357, 26138, 25920, 25706, 25494, 25286, 25081, 24881, 24686, 24496, 24311, 24133, 23960, 23795, 23636,
+        23484, 23341, 23205, 23077, 22958, 22847, 22745, 22653, 22569, 22495, 22431, 22376, 22331, 22296, 22271, 22256,
+        22251, 22256, 22271, 22296, 22331, 22376, 22431, 22495, 22569, 22653, 22745, 22847, 22958, 23077, 23205, 23341,
+        23484, 23636, 23795, 23960, 24133, 24311, 24496, 24686, 24881, 25081, 25286, 25494, 25706, 25920, 26138, 26357,
+        26578, 26800, 27023, 27246, 27468, 27690, 27910, 28129, 28345, 28558, 28767, 28973, 29174, 29370, 29560, 29744,
+        29922, 30092, 30255, 30410, 30556, 30693, 30820, 30938, 31045, 31140, 31225, 31297, 31358, 31405, 31439, 31460,
+        31467, 31460, 31438, 31402, 31350, 31283, 31200, 31101, 30985, 30854, 30705, 30540, 30357, 30158, 29941, 29706,
+        29454, 29185, 28898, 28593, 28271, 27931, 27573, 27198, 26805, 26395, 25968, 25524, 25062, 24584, 24089, 23578,
+        23051, 22508, 21949, 21376, 20787, 20183, 19565, 18934, 18289, 17630, 16959, 16276, 15581, 14875, 14157, 13430,
+        12692, 11945, 11190, 10426, 9654, 8875, 8090, 7298, 6501, 5699, 4893, 4083, 3270, 2455, 1638, 819,
+        0, -819, -1638, -2455, -3270, -4083, -4893, -5699, -6501, -7298, -8090, -8875, -9654, -10426, -11190, -11945,
+        -12692, -13430, -14157, -14875, -15581, -16276, -16959, -17630, -18289, -18934, -19565, -20183, -20787, -21376, -21949, -22508,
+        -23051, -23578, -24089, -24584, -25062, -25524, -25968, -26395, -26805, -27198, -27573, -27931, -28271, -28593, -28898, -29185,
+        -29454, -29706, -29941, -30158, -30357, -30540, -30705, -30854, -30985, -31101, -31200, -31283, -31350, -31402, -31438, -31460,
+        -31467, -31460, -31439, -31405, -31358, -31297, -31225, -31140, -31045, -30938, -30820, -30693, -30556, -30410, -30255, -30092,
+        -29922, -29744, -29560, -29370, -29174, -28973, -28767, -28558, -28345, -28129, -27910, -27690, -27468, -27246, -27023, -26800,
+        -26578, -26357, -26138, -25920, -25706, -25494, -25286, -25081, -24881, -24686, -24496, -24311, -24133, -23960, -23795, -23636,
+        -23484, -23341, -23205, -23077, -22958, -22847, -22745, -22653, -22569, -22495, -22431, -22376, -22331, -22296, -22271, -22256,
+        -22251, -22256, -22271, -22296, -22331, -22376, -22431, -22495, -22569, -22653, -22745, -22847, -22958, -23077, -23205, -23341,
+        -23484, -23636, -23795, -23960, -24133, -24311, -24496, -24686, -24881, -25081, -25286, -25494, -25706, -25920, -26138, -26357,
+        -26578, -26800, -27023, -27246, -27468, -27690, -27910, -28129, -28345, -28558, -28767, -28973, -29174, -29370, -29560, -29744,
+        -29922, -30092, -30255, -30410, -30556, -30693, -30820, -30938, -31045, -31140, -31225, -31297, -31358, -31405, -31439, -31460,
+        -31467, -31460, -31438, -31402, -31350, -31283, -31200, -31101, -30985, -30854, -30705, -30540, -30357, -30158, -29941, -29706,
+        -29454, -29185, -28898, -28593, -28271, -27931, -27573, -27198, -26805, -26395, -25968, -25524, -25062, -24584, -24089, -23578,
+        -23051, -22508, -21949, -21376, -20787, -20183, -19565, -18934, -18289, -17630, -16959, -16276, -15581, -14875, -14157, -13430,
+        -12692, -11945, -11190, -10426, -9654, -8875, -8090, -7298, -6501, -5699, -4893, -4083, -3270, -2455, -1638, -819,
+        0,
+    },
+    {  // level 8, 2 harmonics
+        0, 410, 819, 1228, 1638, 2047, 2455, 2864, 3271, 3679, 4086, 4492, 4897, 5302, 5706, 6109,
+        6511, 6913, 7313, 7712, 8110, 8506, 8902, 9296, 9689, 10080, 10470, 10858, 11244, 11629, 12012, 12393,
+        12773, 13150, 13525, 13899, 14270, 14639, 15006, 15371, 15733, 16093, 16451, 16806, 17159, 17509, 17856, 18201,
+        18543, 18882, 19218, 19552, 19882, 20210, 20534, 20855, 21174, 21489, 21800, 22109, 22414, 22716, 23014, 23309,
+        23601, 23888, 24173, 24453, 24730, 25003, 25273, 25538, 25800, 26058, 26312, 26562, 26808, 27050, 27288, 27522,
+        27751, 27977, 28198, 28415, 28628, 28836, 29040, 29240, 29435, 29626, 29812, 29994, 30172, 30345, 30513, 30677,
+        30836, 30990, 31140, 31285, 31425, 31561, 31692, 31818, 31939, 32056, 32167, 32274, 32376, 32473, 32565, 32653,
+        32735, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+        32735, 32653, 32565, 32473, 32376, 32274, 32167, 32056, 31939, 31818, 31692, 31561, 31425, 31285, 31140, 30990,
+        30836, 30677, 30513, 30345, 30172, 29994, 29812, 29626, 29435, 29240, 29040, 28836, 28628, 28415, 28198, 27977,
+        27751, 27522, 27288, 27050, 26808, 26562, 26312, 26058, 25800, 25538, 25273, 25003, 24730, 24453, 24173, 23888,
+        23601, 23309, 23014, 22716, 22414, 22109, 21800, 21489, 21174, 20855, 20534, 20210, 19882, 19552, 19218, 18882,
+        18543, 18201, 17856, 17509, 17159, 16806, 16451, 16093, 15733, 15371, 15006, 14639, 14270, 13899, 13525, 13150,
+        12773, 12393, 12012, 11629, 11244, 10858, 10470, 10080, 9689, 9296, 8902, 8506, 8110, 7712, 7313, 6913,
+        6511, 6109, 5706, 5302, 4897, 4492, 4086, 3679, 3271, 2864, 2455, 2047, 1638, 1228, 819, 410,
+        0, -410, -819, -1228, -1638, -2047, -2455, -2864, -3271, -3679, -4086, -4492, -4897, -5302, -5706, -6109,
+        -6511, -6913, -7313, -7712, -8110, -8506, -8902, -9296, -9689, -10080, -10470, -10858, -11244, -11629, -12012, -12393,
+        -12773, -13150, -13525, -13899, -14270, -14639, -15006, -15371, -15733, -16093, -16451, -16806, -17159, -17509, -17856, -18201,
+        -18543, -18882, -19218, -19552, -19882, -20210, -20534, -20855, -21174, -21489, -21800, -22109, -22414, -22716, -23014, -23309,
+        -23601, -23888, -24173, -24453, -24730, -25003, -25273, -25538, -25800, -26058, -26312, -26562, -26808, -27050, -27288, -27522,
+        -27751, -27977, -28198, -28415, -28628, -28836, -29040, -29240, -29435, -29626, -29812, -29994, -30172, -30345, -30513, -30677,
+        -30836, -30990, -31140, -31285, -31425, -31561, -31692, -31818, -31939, -32056, -32167, -32274, -32376, -32473, -32565, -32653,
+        -32735, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+        -32735, -32653, -32565, -32473, -32376, -32274, -32167, -32056, -31939, -31818, -31692, -31561, -31425, -31285, -31140, -30990,
+        -30836, -30677, -30513, -30345, -30172, -29994, -29812, -29626, -29435, -29240, -29040, -28836, -28628, -28415, -28198, -27977,
+        -27751, -27522, -27288, -27050, -26808, -26562, -26312, -26058, -25800, -25538, -25273, -25003, -24730, -24453, -24173, -23888,
+        -23601, -23309, -23014, -22716, -22414, -22109, -21800, -21489, -21174, -20855, -20534, -20210, -19882, -19552, -19218, -18882,
+        -18543, -18201, -17856, -17509, -17159, -16806, -16451, -16093, -15733, -15371, -15006, -14639, -14270, -13899, -13525, -13150,
+        -12773, -12393, -12012, -11629, -11244, -10858, -10470, -10080, -9689, -9296, -8902, -8506, -8110, -7712, -7313, -6913,
+        -6511, -6109, -5706, -5302, -4897, -4492, -4086, -3679, -3271, -2864, -2455, -2047, -1638, -1228, -819, -410,
+        0,
+    },
+    {  // level 9, 1 harmonics
+        0, 410, 819, 1228, 1638, 2047, 2455, 2864, 3271, 3679, 4086, 4492, 4897, 5302, 5706, 6109,
+        6511, 6913, 7313, 7712, 8110, 8506, 8902, 9296, 9689, 10080, 10470, 10858, 11244, 11629, 12012, 12393,
+        12773, 13150, 13525, 13899, 14270, 14639, 15006, 15371, 15733, 16093, 16451, 16806, 17159, 17509, 17856, 18201,
+        18543, 18882, 19218, 19552, 19882, 20210, 20534, 20855, 21174, 21489, 21800, 22109, 22414, 22716, 23014, 23309,
+        23601, 23888, 24173, 24453, 24730, 25003, 25273, 25538, 25800, 26058, 26312, 26562, 26808, 27050, 27288, 27522,
+        27751, 27977, 28198, 28415, 28628, 28836, 29040, 29240, 29435, 29626, 29812, 29994, 30172, 30345, 30513, 30677,
+        30836, 30990, 31140, 31285, 31425, 31561, 31692, 31818, 31939, 32056, 32167, 32274, 32376, 32473, 32565, 32653,
+        32735, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+        32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+        32735, 32653, 32565, 32473, 32376, 32274, 32167, 32056, 31939, 31818, 31692, 31561, 31425, 31285, 31140, 30990,
+        30836, 30677, 30513, 30345, 30172, 29994, 29812, 29626, 29435, 29240, 29040, 28836, 28628, 28415, 28198, 27977,
+        27751, 27522, 27288, 27050, 26808, 26562, 26312, 26058, 25800, 25538, 25273, 25003, 24730, 24453, 24173, 23888,
+        23601, 23309, 23014, 22716, 22414, 22109, 21800, 21489, 21174, 20855, 20534, 20210, 19882, 19552, 19218, 18882,
+        18543, 18201, 17856, 17509, 17159, 16806, 16451, 16093, 15733, 15371, 15006, 14639, 14270, 13899, 13525, 13150,
+        12773, 12393, 12012, 11629, 11244, 10858, 10470, 10080, 9689, 9296, 8902, 8506, 8110, 7712, 7313, 6913,
+        6511, 6109, 5706, 5302, 4897, 4492, 4086, 3679, 3271, 2864, 2455, 2047, 1638, 1228, 819, 410,
+        0, -410, -819, -1228, -1638, -2047, -2455, -2864, -3271, -3679, -4086, -4492, -4897, -5302, -5706, -6109,
+        -6511, -6913, -7313, -7712, -8110, -8506, -8902, -9296, -9689, -10080, -10470, -10858, -11244, -11629, -12012, -12393,
+        -12773, -13150, -13525, -13899, -14270, -14639, -15006, -15371, -15733, -16093, -16451, -16806, -17159, -17509, -17856, -18201,
+        -18543, -18882, -19218, -19552, -19882, -20210, -20534, -20855, -21174, -21489, -21800, -22109, -22414, -22716, -23014, -23309,
+        -23601, -23888, -24173, -24453, -24730, -25003, -25273, -25538, -25800, -26058, -26312, -26562, -26808, -27050, -27288, -27522,
+        -27751, -27977, -28198, -28415, -28628, -28836, -29040, -29240, -29435, -29626, -29812, -29994, -30172, -30345, -30513, -30677,
+        -30836, -30990, -31140, -31285, -31425, -31561, -31692, -31818, -31939, -32056, -32167, -32274, -32376, -32473, -32565, -32653,
+        -32735, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+        -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+        -32735, -32653, -32565, -32473, -32376, -32274, -32167, -32056, -31939, -31818, -31692, -31561, -31425, -31285, -31140, -30990,
+        -30836, -30677, -30513, -30345, -30172, -29994, -29812, -29626, -29435, -29240, -29040, -28836, -28628, -28415, -28198, -27977,
+        -27751, -27522, -27288, -27050, -26808, -26562, -26312, -26058, -25800, -25538, -25273, -25003, -24730, -24453, -24173, -23888,
+        -23601, -23309, -23014, -22716, -22414, -22109, -21800, -21489, -21174, -20855, -20534, -20210, -19882, -19552, -19218, -18882,
+        -18543, -18201, -17856, -17509, -17159, -16806, -16451, -16093, -15733, -15371, -15006, -14639, -14270, -13899, -13525, -13150,
+        -12773, -12393, -12012, -11629, -11244, -10858, -10470, -10080, -9689, -9296, -8902, -8506, -8110, -7712, -7313, -6913,
+        -6511, -6109, -5706, -5302, -4897, -4492, -4086, -3679, -3271, -2864, -2455, -2047, -1638, -1228, -819, -410,
+        0,
+    },
+};
+
+const int16_t kWavetableTriangle[kWavetableLevels][kWavetableSize + 1] PROGMEM = {
+    {  // level 0, 170 harmonics
+        -26151, -26030, -25796, -25596, -25401, -25185, -24984, -24784, -24572, -24370, -24168, -23959, -23756, -23553, -23345, -23141,
+        -22939, -22731, -22527, -22324, -22117, -21913, -21709, -21502, -21298, -21095, -20888, -20684, -20480, -20274, -20070, -19866,
+        -19660, -19455, -19251, -19045, -18841, -18637, -18431, -18226, -18023, -17817, -17612, -17408, -17202, -16998, -16794, -16588,
+        -16383, -16179, -15974, -15769, -15565, -15359, -15154, -14951, -14745, -14540, -14336, -14130, -13926, -13722, -13516, -13311,
+        -13107, -12902, -12697, -12493, -12287, -12083, -11879, -11673, -11468, -11264, -11059, -10854, -10650, -10444, -10239, -10035,
+        -9830, -9625, -9421, -9216, -9011, -8807, -8601, -8396, -8192, -7987, -7782, -7578, -7372, -7168, -6963, -6758,
+        -6553, -6349, -6144, -5939, -5735, -5529, -5324, -5120, -4915, -4710, -4506, -4301, -4096, -3891, -3686, -3481,
+        -3277, -3072, -2867, -2663, -2457, -2252, -2048, -1843, -1638, -1434, -1229, -1024, -819, -614, -409, -205,
+        0, 205, 409, 614, 819, 1024, 1229, 1434, 1638, 1843, 2048, 2252, 2457, 2663, 2867, 3072,
+        3277, 3481, 3686, 3891, 4096, 4301, 4506, 4710, 4915, 5120, 5324, 5529, 5735, 5939, 6144, 6349,
+        6553, 6758, 6963, 7168, 7372, 7578, 7782, 7987, 8192, 8396, 8601, 8807, 9011, 9216, 9421, 9625,
+        9830, 10035, 10239, 10444, 10650, 10854, 11059, 11264, 11468, 11673, 11879, 12083, 12287, 12493, 12697, 12902,
+        13107, 13311, 13516, 13722, 13926, 14130, 14336, 14540, 14745, 14951, 15154, 15359, 15565, 15769, 15974, 16179,
+        16383, 16588, 16794, 16998, 17202, 17408, 17612, 17817, 18023, 18226, 18431, 18637, 18841, 19045, 19251, 19455,
+        19660, 19866, 20070, 20274, 20480, 20684, 20888, 21095, 21298, 21502, 21709, 21913, 22117, 22324, 22527, 22731,
+        22939, 23141, 23345, 23553, 23756, 23959, 24168, 24370, 24572, 24784, 24984, 25185, 25401, 25596, 25796, 26030,
+        26151, 26030, 25796, 25596, 25401, 25185, 24984, 24784, 24572, 24370, 24168, 23959, 23756, 23553, 23345, 23141,
+        22939, 22731, 22527, 22324, 22117, 21913, 21709, 21502, 21298, 21095, 20888, 20684, 20480, 20274, 20070, 19866,
+        19660, 19455, 19251, 19045, 18841, 18637, 18431, 18226, 18023, 17817, 17612, 17408, 17202, 16998, 16794, 16588,
+        16383, 16179, 15974, 15769, 15565, 15359, 15154, 14951, 14745, 14540, 14336, 14130, 13926, 13722, 13516, 13311,
+        13107, 12902, 12697, 12493, 12287, 12083, 11879, 11673, 11468, 11264, 11059, 10854, 10650, 10444, 10239, 10035,
+        9830, 9625, 9421, 9216, 9011, 8807, 8601, 8396, 8192, 7987, 7782, 7578, 7372, 7168, 6963, 6758,
+        6553, 6349, 6144, 5939, 5735, 5529, 5324, 5120, 4915, 4710, 4506, 4301, 4096, 3891, 3686, 3481,
+        3277, 3072, 2867, 2663, 2457, 2252, 2048, 1843, 1638, 1434, 1229, 1024, 819, 614, 409, 205,
+        0, -205, -409, -614, -819, -1024, -1229, -1434, -1638, -1843, -2048, -2252, -2457, -2663, -2867, -3072,
+        -3277, -3481, -3686, -3891, -4096, -4301, -4506, -4710, -4915, -5120, -5324, -5529, -5735, -5939, -6144, -6349,
+        -6553, -6758, -6963, -7168, -7372, -7578, -7782, -7987, -8192, -8396, -8601, -8807, -9011, -9216, -9421, -9625,
+        -9830, -10035, -10239, -10444, -10650, -10854, -11059, -11264, -11468, -11673, -11879, -12083, -12287, -12493, -12697, -12902,
+        -13107, -13311, -13516, -13722, -13926, -14130, -14336, -14540, -14745, -14951, -15154, -15359, -15565, -15769, -15974, -16179,
+        -16383, -16588, -16794, -16998, -17202, -17408, -17612, -17817, -18023, -18226, -18431, -18637, -18841, -19045, -19251, -19455,
+        -19660, -19866, -20070, -20274, -20480, -20684, -20888, -21095, -21298, -21502, -21709, -21913, -22117, -22324, -22527, -22731,
+        -22939, -23141, -23345, -23553, -23756, -23959, -24168, -24370, -24572, -24784, -24984, -25185, -25401, -25596, -25796, -26030,
+        -26151,
+    },
+    {  // level 1, 170 harmonics
+        -26151, -26030, -25796, -25596, -25401, -25185, -24984, -24784, -24572, -24370, -24168, -23959, -23756, -23553, -23345, -23141,
+        -22939, -22731, -22527, -22324, -22117, -21913, -21709, -21502, -21298, -21095, -20888, -20684, -20480, -20274, -20070, -19866,
+        -19660, -19455, -19251, -19045, -18841, -18637, -18431, -18226, -18023, -17817, -17612, -17408, -17202, -16998, -16794, -16588,
+        -16383, -16179, -15974, -15769, -15565, -15359, -15154, -14951, -14745, -14540, -14336, -14130, -13926, -13722, -13516, -13311,
+        -13107, -12902, -12697, -12493, -12287, -12083, -11879, -11673, -11468, -11264, -11059, -10854, -10650, -10444, -10239, -10035,
+        -9830, -9625, -9421, -9216, -9011, -8807, -8601, -8396, -8192, -7987, -7782, -7578, -7372, -7168, -6963, -6758,
+        -6553, -6349, -6144, -5939, -5735, -5529, -5324, -5120, -4915, -4710, -4506, -4301, -4096, -3891, -3686, -3481,
+        -3277, -3072, -2867, -2663, -2457, -2252, -2048, -1843, -1638, -1434, -1229, -1024, -819, -614, -409, -205,
+        0, 205, 409, 614, 819, 1024, 1229, 1434, 1638, 1843, 2048, 2252, 2457, 2663, 2867, 3072,
+        3277, 3481, 3686, 3891, 4096, 4301, 4506, 4710, 4915, 5120, 5324, 5529, 5735, 5939, 6144, 6349,
+        6553, 6758, 6963, 7168, 7372, 7578, 7782, 7987, 8192, 8396, 8601, 8807, 9011, 9216, 9421, 9625,
+        9830, 10035, 10239, 10444, 10650, 10854, 11059, 11264, 11468, 11673, 11879, 12083, 12287, 12493, 12697, 12902,
+        13107, 13311, 13516, 13722, 13926, 14130, 14336, 14540, 14745, 14951, 15154, 15359, 15565, 15769, 15974, 16179,
+        16383, 16588, 16794, 16998, 17202, 17408, 17612, 17817, 18023, 18226, 18431, 18637, 18841, 19045, 19251, 19455,
+        19660, 19866, 20070, 20274, 20480, 20684, 20888, 21095, 21298, 21502, 21709, 21913, 22117, 22324, 22527, 22731,
+        22939, 23141, 23345, 23553, 23756, 23959, 24168, 24370, 24572, 24784, 24984, 25185, 25401, 25596, 25796, 26030,
+        26151, 26030, 25796, 25596, 25401, 25185, 24984, 24784, 24572, 24370, 24168, 23959, 23756, 23553, 23345, 23141,
+        22939, 22731, 22527, 22324, 22117, 21913, 21709, 21502, 21298, 21095, 20888, 20684, 20480, 20274, 20070, 19866,
+        19660, 19455, 19251, 19045, 18841, 18637, 18431, 18226, 18023, 17817, 17612, 17408, 17202, 16998, 16794, 16588,
+        16383, 16179, 15974, 15769, 15565, 15359, 15154, 14951, 14745, 14540, 14336, 14130, 13926, 13722, 13516, 13311,
+        13107, 12902, 12697, 12493, 12287, 12083, 11879, 11673, 11468, 11264, 11059, 10854, 10650, 10444, 10239, 10035,
+        9830, 9625, 9421, 9216, 9011, 8807, 8601, 8396, 8192, 7987, 7782, 7578, 7372, 7168, 6963, 6758,
+        6553, 6349, 6144, 5939, 5735, 5529, 5324, 5120, 4915, 4710, 4506, 4301, 4096, 3891, 3686, 3481,
+        3277, 3072, 2867, 2663, 2457, 2252, 2048, 1843, 1638, 1434, 1229, 1024, 819, 614, 409, 205,
+        0, -205, -409, -614, -819, -1024, -1229, -1434, -1638, -1843, -2048, -2252, -2457, -2663, -2867, -3072,
+        -3277, -3481, -3686, -3891, -4096, -4301, -4506, -4710, -4915, -5120, -5324, -5529, -5735, -5939, -6144, -6349,
+        -6553, -6758, -6963, -7168, -7372, -7578, -7782, -7987, -8192, -8396, -8601, -8807, -9011, -9216, -9421, -9625,
+        -9830, -10035, -10239, -10444, -10650, -10854, -11059, -11264, -11468, -11673, -11879, -12083, -12287, -12493, -12697, -12902,
+        -13107, -13311, -13516, -13722, -13926, -14130, -14336, -14540, -14745, -14951, -15154, -15359, -15565, -15769, -15974, -16179,
+        -16383, -16588, -16794, -16998, -17202, -17408, -17612, -17817, -18023, -18226, -18431, -18637, -18841, -19045, -19251, -19455,
+        -19660, -19866, -20070, -20274, -20480, -20684, -20888, -21095, -21298, -21502, -21709, -21913, -22117, -22324, -22527, -22731,
+        -22939, -23141, -23345, -23553, -23756, -23959, -24168, -24370, -24572, -24784, -24984, -25185, -25401, -25596, -25796, -26030,
+        -26151,
+    },
+    {  // level 2, 128 harmonics
+        -26131, -26035, -25814, -25585, -25391, -25199, -24987, -24773, -24574, -24376, -24166, -23956, -23756, -23555, -23347, -23138,
+        -22937, -22735, -22528, -22320, -22118, -21915, -21708, -21501, -21298, -21096, -20889, -20682, -20479, -20276, -20070, -19863,
+        -19660, -19457, -19251, -19044, -18841, -18638, -18431, -18225, -18022, -17818, -17612, -17406, -17203, -16999, -16793, -16587,
+        -16383, -16180, -15974, -15768, -15564, -15361, -15155, -14949, -14745, -14541, -14336, -14130, -13926, -13722, -13516, -13311,
+        -13107, -12903, -12697, -12492, -12288, -12084, -11878, -11672, -11468, -11264, -11059, -10853, -10649, -10445, -10240, -10034,
+        -9830, -9626, -9421, -9215, -9011, -8807, -8601, -8396, -8192, -7988, -7782, -7577, -7373, -7168, -6963, -6757,
+        -6553, -6349, -6144, -5938, -5734, -5530, -5325, -5119, -4915, -4711, -4505, -4300, -4096, -3892, -3686, -3481,
+        -3277, -3073, -2867, -2662, -2458, -2253, -2048, -1842, -1638, -1434, -1229, -1023, -819, -615, -410, -204,
+        0, 204, 410, 615, 819, 1023, 1229, 1434, 1638, 1842, 2048, 2253, 2458, 2662, 2867, 3073,
+        3277, 3481, 3686, 3892, 4096, 4300, 4505, 4711, 4915, 5119, 5325, 5530, 5734, 5938, 6144, 6349,
+        6553, 6757, 6963, 7168, 7373, 7577, 7782, 7988, 8192, 8396, 8601, 8807, 9011, 9215, 9421, 9626,
+        9830, 10034, 10240, 10445, 10649, 10853, 11059, 11264, 11468, 11672, 11878, 12084, 12288, 12492, 12697, 12903,
+        13107, 13311, 13516, 13722, 13926, 14130, 14336, 14541, 14745, 14949, 15155, 15361, 15564, 15768, 15974, 16180,
+        16383, 16587, 16793, 16999, 17203, 17406, 17612, 17818, 18022, 18225, 18431, 18638, 18841, 19044, 19251, 19457,
+        19660, 19863, 20070, 20276, 20479, 20682, 20889, 21096, 21298, 21501, 21708, 21915, 22118, 22320, 22528, 22735,
+        22937, 23138, 23347, 23555, 23756, 23956, 24166, 24376, 24574, 24773, 24987, 25199, 25391, 25585, 25814, 26035,
+        26131, 26035, 25814, 25585, 25391, 25199, 24987, 24773, 24574, 24376, 24166, 23956, 23756, 23555, 23347, 23138,
+        22937, 22735, 22528, 22320, 22118, 21915, 21708, 21501, 21298, 21096, 20889, 20682, 20479, 20276, 20070, 19863,
+        19660, 19457, 19251, 19044, 18841, 18638, 18431, 18225, 18022, 17818, 17612, 17406, 17203, 16999, 16793, 16587,
+        16383, 16180, 15974, 15768, 15564, 15361, 15155, 14949, 14745, 14541, 14336, 14130, 13926, 13722, 13516, 13311,
+        13107, 12903, 12697, 12492, 12288, 12084, 11878, 11672, 11468, 11264, 11059, 10853, 10649, 10445, 10240, 10034,
+        9830, 9626, 9421, 9215, 9011, 8807, 8601, 8396, 8192, 7988, 7782, 7577, 7373, 7168, 6963, 6757,
+        6553, 6349, 6144, 5938, 5734, 5530, 5325, 5119, 4915, 4711, 4505, 4300, 4096, 3892, 3686, 3481,
+        3277, 3073, 2867, 2662, 2458, 2253, 2048, 1842, 1638, 1434, 1229, 1023, 819, 615, 410, 204,
+        0, -204, -410, -615, -819, -1023, -1229, -1434, -1638, -1842, -2048, -2253, -2458, -2662, -2867, -3073,
+        -3277, -3481, -3686, -3892, -4096, -4300, -4505, -4711, -4915, -5119, -5325, -5530, -5734, -5938, -6144, -6349,
+        -6553, -6757, -6963, -7168, -7373, -7577, -7782, -7988, -8192, -8396, -8601, -8807, -9011, -9215, -9421, -9626,
+        -9830, -10034, -10240, -10445, -10649, -10853, -11059, -11264, -11468, -11672, -11878, -12084, -12288, -12492, -12697, -12903,
+        -13107, -13311, -13516, -13722, -13926, -14130, -14336, -14541, -14745, -14949, -15155, -15361, -15564, -15768, -15974, -16180,
+        -16383, -16587, -16793, -16999, -17203, -17406, -17612, -17818, -18022, -18225, -18431, -18638, -18841, -19044, -19251, -19457,
+        -19660, -19863, -20070, -20276, -20479, -20682, -20889, -21096, -21298, -21501, -21708, -21915, -22118, -22320, -22528, -22735,
+        -22937, -23138, -23347, -23555, -23756, -23956, -24166, -24376, -24574, -24773, -24987, -25199, -25391, -25585, -25814, -26035,
+        -26131,
+    },
+    {  // level 3, 64 harmonics
+        -26048, -25997, -25856, -25651, -25414, -25176, -24955, -24756, -24568, -24382, -24185, -23976, -23759, -23542, -23332, -23130,
+        -22935, -22739, -22539, -22331, -22119, -21907, -21699, -21496, -21298, -21099, -20897, -20690, -20480, -20270, -20063, -19860,
+        -19660, -19460, -19257, -19050, -18841, -18632, -18426, -18222, -18022, -17821, -17617, -17411, -17203, -16995, -16788, -16585,
+        -16383, -16182, -15978, -15772, -15565, -15357, -15151, -14947, -14745, -14543, -14340, -14134, -13926, -13719, -13513, -13309,
+        -13107, -12904, -12701, -12495, -12288, -12080, -11875, -11671, -11468, -11266, -11062, -10856, -10649, -10442, -10237, -10033,
+        -9830, -9627, -9424, -9218, -9011, -8804, -8598, -8394, -8192, -7989, -7785, -7579, -7373, -7166, -6960, -6756,
+        -6553, -6351, -6147, -5941, -5734, -5528, -5322, -5118, -4915, -4712, -4508, -4303, -4096, -3889, -3684, -3480,
+        -3277, -3074, -2870, -2664, -2458, -2251, -2045, -1841, -1638, -1435, -1231, -1026, -819, -613, -407, -203,
+        0, 203, 407, 613, 819, 1026, 1231, 1435, 1638, 1841, 2045, 2251, 2458, 2664, 2870, 3074,
+        3277, 3480, 3684, 3889, 4096, 4303, 4508, 4712, 4915, 5118, 5322, 5528, 5734, 5941, 6147, 6351,
+        6553, 6756, 6960, 7166, 7373, 7579, 7785, 7989, 8192, 8394, 8598, 8804, 9011, 9218, 9424, 9627,
+        9830, 10033, 10237, 10442, 10649, 10856, 11062, 11266, 11468, 11671, 11875, 12080, 12288, 12495, 12701, 12904,
+        13107, 13309, 13513, 13719, 13926, 14134, 14340, 14543, 14745, 14947, 15151, 15357, 15565, 15772, 15978, 16182,
+        16383, 16585, 16788, 16995, 17203, 17411, 17617, 17821, 18022, 18222, 18426, 18632, 18841, 19050, 19257, 19460,
+        19660, 19860, 20063, 20270, 20480, 20690, 20897, 21099, 21298, 21496, 21699, 21907, 22119, 22331, 22539, 22739,
+        22935, 23130, 23332, 23542, 23759, 23976, 24185, 24382, 24568, 24756, 24955, 25176, 25414, 25651, 25856, 25997,
+        26048, 25997, 25856, 25651, 25414, 25176, 24955, 24756, 24568, 24382, 24185, 23976, 23759, 23542, 23332, 23130,
+        22935, 22739, 22539, 22331, 22119, 21907, 21699, 21496, 21298, 21099, 20897, 20690, 20480, 20270, 20063, 19860,
+        19660, 19460, 19257, 19050, 18841, 18632, 18426, 18222, 18022, 17821, 17617, 17411, 17203, 16995, 16788, 16585,
+        16383, 16182, 15978, 15772, 15565, 15357, 15151, 14947, 14745, 14543, 14340, 14134, 13926, 13719, 13513, 13309,
+        13107, 12904, 12701, 12495, 12288, 12080, 11875, 11671, 11468, 11266, 11062, 10856, 10649, 10442, 10237, 10033,
+        9830, 9627, 9424, 9218, 9011, 8804, 8598, 8394, 8192, 7989, 7785, 7579, 7373, 7166, 6960, 6756,
+        6553, 6351, 6147, 5941, 5734, 5528, 5322, 5118, 4915, 4712, 4508, 4303, 4096, 3889, 3684, 3480,
+        3277, 3074, 2870, 2664, 2458, 2251, 2045, 1841, 1638, 1435, 1231, 1026, 819, 613, 407, 203,
+        0, -203, -407, -613, -819, -1026, -1231, -1435, -1638, -1841, -2045, -2251, -2458, -2664, -2870, -3074,
+        -3277, -3480, -3684, -3889, -4096, -4303, -4508, -4712, -4915, -5118, -5322, -5528, -5734, -5941, -6147, -6351,
+        -6553, -6756, -6960, -7166, -7373, -7579, -7785, -7989, -8192, -8394, -8598, -8804, -9011, -9218, -9424, -9627,
+        -9830, -10033, -10237, -10442, -10649, -10856, -11062, -11266, -11468, -11671, -11875, -12080, -12288, -12495, -12701, -12904,
+        -13107, -13309, -13513, -13719, -13926, -14134, -14340, -14543, -14745, -14947, -15151, -15357, -15565, -15772, -15978, -16182,
+        -16383, -16585, -16788, -16995, -17203, -17411, -17617, -17821, -18022, -18222, -18426, -18632, -18841, -19050, -19257, -19460,
+        -19660, -19860, -20063, -20270, -20480, -20690, -20897, -21099, -21298, -21496, -21699, -21907, -22119, -22331, -22539, -22739,
+        -22935, -23130, -23332, -23542, -23759, -23976, -24185, -24382, -24568, -24756, -24955, -25176, -25414, -25651, -25856, -25997,
+        -26048,
+    },
+    {  // level 4, 32 harmonics
+        -25882, -25856, -25781, -25660, -25499, -25305, -25087, -24854, -24614, -24373, -24138, -23912, -23697, -23493, -23297, -23109,
+        -22923, -22738, -22550, -22357, -22157, -21951, -21739, -21523, -21305, -21087, -20871, -20658, -20450, -20246, -20047, -19851,
+        -19656, -19462, -19266, -19067, -18865, -18659, -18449, -18237, -18024, -17811, -17599, -17390, -17183, -16979, -16778, -16579,
+        -16382, -16184, -15985, -15785, -15582, -15376, -15167, -14957, -14746, -14535, -14325, -14117, -13911, -13707, -13505, -13305,
+        -13106, -12907, -12707, -12505, -12302, -12096, -11888, -11679, -11469, -11259, -11050, -10842, -10636, -10433, -10230, -10030,
+        -9830, -9630, -9429, -9227, -9023, -8817, -8610, -8401, -8192, -7983, -7774, -7567, -7361, -7157, -6955, -6754,
+        -6553, -6353, -6151, -5949, -5745, -5540, -5332, -5124, -4915, -4706, -4498, -4291, -4085, -3881, -3679, -3477,
+        -3277, -3076, -2874, -2672, -2468, -2262, -2055, -1847, -1638, -1430, -1221, -1014, -809, -605, -402, -201,
+        0, 201, 402, 605, 809, 1014, 1221, 1430, 1638, 1847, 2055, 2262, 2468, 2672, 2874, 3076,
+        3277, 3477, 3679, 3881, 4085, 4291, 4498, 4706, 4915, 5124, 5332, 5540, 5745, 5949, 6151, 6353,
+        6553, 6754, 6955, 7157, 7361, 7567, 7774, 7983, 8192, 8401, 8610, 8817, 9023, 9227, 9429, 9630,
+        9830, 10030, 10230, 10433, 10636, 10842, 11050, 11259, 11469, 11679, 11888, 12096, 12302, 12505, 12707, 12907,
+        13106, 13305, 13505, 13707, 13911, 14117, 14325, 14535, 14746, 14957, 15167, 15376, 15582, 15785, 15985, 16184,
+        16382, 16579, 16778, 16979, 17183, 17390, 17599, 17811, 18024, 18237, 18449, 18659, 18865, 19067, 19266, 19462,
+        19656, 19851, 20047, 20246, 20450, 20658, 20871, 21087, 21305, 21523, 21739, 21951, 22157, 22357, 22550, 22738,
+        22923, 23109, 23297, 23493, 23697, 23912, 24138, 24373, 24614, 24854, 25087, 25305, 25499, 25660, 25781, 25856,
+        25882, 25856, 25781, 25660, 25499, 25305, 25087, 24854, 24614, 24373, 24138, 23912, 23697, 23493, 23297, 23109,
+        22923, 22738, 22550, 22357, 22157, 21951, 21739, 21523, 21305, 21087, 20871, 20658, 20450, 20246, 20047, 19851,
+        19656, 19462, 19266, 19067, 18865, 18659, 18449, 18237, 18024, 17811, 17599, 17390, 17183, 16979, 16778, 16579,
+        16382, 16184, 15985, 15785, 15582, 15376, 15167, 14957, 14746, 14535, 14325, 14117, 13911, 13707, 13505, 13305,
+        13106, 12907, 12707, 12505, 12302, 12096, 11888, 11679, 11469, 11259, 11050, 10842, 10636, 10433, 10230, 10030,
+        9830, 9630, 9429, 9227, 9023, 8817, 8610, 8401, 8192, 7983, 7774, 7567, 7361, 7157, 6955, 6754,
+        6553, 6353, 6151, 5949, 5745, 5540, 5332, 5124, 4915, 4706, 4498, 4291, 4085, 3881, 3679, 3477,
+        3277, 3076, 2874, 2672, 2468, 2262, 2055, 1847, 1638, 1430, 1221, 1014, 809, 605, 402, 201,
+        0, -201, -402, -605, -809, -1014, -1221, -1430, -1638, -1847, -2055, -2262, -2468, -2672, -2874, -3076,
+        -3277, -3477, -3679, -3881, -4085, -4291, -4498, -4706, -4915, -5124, -5332, -5540, -5745, -5949, -6151, -6353,
+        -6553, -6754, -6955, -7157, -7361, -7567, -7774, -7983, -8192, -8401, -8610, -8817, -9023, -9227, -9429, -9630,
+        -9830, -10030, -10230, -10433, -10636, -10842, -11050, -11259, -11469, -11679, -11888, -12096, -12302, -12505, -12707, -12907,
+        -13106, -13305, -13505, -13707, -13911, -14117, -14325, -14535, -14746, -14957, -15167, -15376, -15582, -15785, -15985, -16184,
+        -16382, -16579, -16778, -16979, -17183, -17390, -17599, -17811, -18024, -18237, -18449, -18659, -18865, -19067, -19266, -19462,
+        -19656, -19851, -20047, -20246, -20450, -20658, -20871, -21087, -21305, -21523, -21739, -21951, -22157, -22357, -22550, -22738,
+        -22923, -23109, -23297, -23493, -23697, -23912, -24138, -24373, -24614, -24854, -25087, -25305, -25499, -25660, -25781, -25856,
+        -25882,
+    },
+    {  // level 5, 16 harmonics
+        -25550, -25538, -25499, -25436, -25349, -25239, -25107, -24955, -24785, -24598, -24397, -24184, -23961, -23731, -23495, -23255,
+        -23014, -22772, -22532, -22295, -22062, -21833, -21609, -21391, -21179, -20972, -20770, -20573, -20380, -20191, -20004, -19818,
+        -19634, -19449, -19264, -19077, -18889, -18697, -18502, -18305, -18103, -17899, -17691, -17480, -17267, -17051, -16834, -16615,
+        -16396, -16177, -15958, -15741, -15525, -15311, -15099, -14889, -14682, -14478, -14276, -14076, -13878, -13682, -13487, -13293,
+        -13100, -12907, -12713, -12518, -12322, -12124, -11925, -11724, -11521, -11315, -11108, -10899, -10688, -10476, -10263, -10049,
+        -9834, -9620, -9405, -9192, -8980, -8769, -8559, -8352, -8146, -7941, -7739, -7538, -7339, -7141, -6944, -6747,
+        -6551, -6355, -6159, -5962, -5764, -5564, -5364, -5162, -4958, -4752, -4545, -4337, -4127, -3915, -3703, -3491,
+        -3278, -3065, -2852, -2640, -2429, -2219, -2010, -1803, -1597, -1393, -1191, -990, -790, -591, -394, -197,
+        0, 197, 394, 591, 790, 990, 1191, 1393, 1597, 1803, 2010, 2219, 2429, 2640, 2852, 3065,
+        3278, 3491, 3703, 3915, 4127, 4337, 4545, 4752, 4958, 5162, 5364, 5564, 5764, 5962, 6159, 6355,
+        6551, 6747, 6944, 7141, 7339, 7538, 7739, 7941, 8146, 8352, 8559, 8769, 8980, 9192, 9405, 9620,
+        9834, 10049, 10263, 10476, 10688, 10899, 11108, 11315, 11521, 11724, 11925, 12124, 12322, 12518, 12713, 12907,
+        13100, 13293, 13487, 13682, 13878, 14076, 14276, 14478, 14682, 14889, 15099, 15311, 15525, 15741, 15958, 16177,
+        16396, 16615, 16834, 17051, 17267, 17480, 17691, 17899, 18103, 18305, 18502, 18697, 18889, 19077, 19264, 19449,
+        19634, 19818, 20004, 20191, 20380, 20573, 20770, 20972, 21179, 21391, 21609, 21833, 22062, 22295, 22532, 22772,
+        23014, 23255, 23495, 23731, 23961, 24184, 24397, 24598, 24785, 24955, 25107, 25239, 25349, 25436, 25499, 25538,
+        25550, 25538, 25499, 25436, 25349, 25239, 25107, 24955, 24785, 24598, 24397, 24184, 23961, 23731, 23495, 23255,
+        23014, 22772, 22532, 22295, 22062, 21833, 21609, 21391, 21179, 20972, 20770, 20573, 20380, 20191, 20004, 19818,
+        19634, 19449, 19264, 19077, 18889, 18697, 18502, 18305, 18103, 17899, 17691, 17480, 17267, 17051, 16834, 16615,
+        16396, 16177, 15958, 15741, 15525, 15311, 15099, 14889, 14682, 14478, 14276, 14076, 13878, 13682, 13487, 13293,
+        13100, 12907, 12713, 12518, 12322, 12124, 11925, 11724, 11521, 11315, 11108, 10899, 10688, 10476, 10263, 10049,
+        9834, 9620, 9405, 9192, 8980, 8769, 8559, 8352, 8146, 7941, 7739, 7538, 7339, 7141, 6944, 6747,
+        6551, 6355, 6159, 5962, 5764, 5564, 5364, 5162, 4958, 4752, 4545, 4337, 4127, 3915, 3703, 3491,
+        3278, 3065, 2852, 2640, 2429, 2219, 2010, 1803, 1597, 1393, 1191, 990, 790, 591, 394, 197,
+        0, -197, -394, -591, -790, -990, -1191, -1393, -1597, -1803, -2010, -2219, -2429, -2640, -2852, -3065,
+        -3278, -3491, -3703, -3915, -4127, -4337, -4545, -4752, -4958, -5162, -5364, -5564, -5764, -5962, -6159, -6355,
+        -6551, -6747, -6944, -7141, -7339, -7538, -7739, -7941, -8146, -8352, -8559, -8769, -8980, -9192, -9405, -9620,
+        -9834, -10049, -10263, -10476, -10688, -10899, -11108, -11315, -11521, -11724, -11925, -12124, -12322, -12518, -12713, -12907,
+        -13100, -13293, -13487, -13682, -13878, -14076, -14276, -14478, -14682, -14889, -15099, -15311, -15525, -15741, -15958, -16177,
+        -16396, -16615, -16834, -17051, -17267, -17480, -17691, -17899, -18103, -18305, -18502, -18697, -18889, -19077, -19264, -19449,
+        -19634, -19818, -20004, -20191, -20380, -20573, -20770, -20972, -21179, -21391, -21609, -21833, -22062, -22295, -22532, -22772,
+        -23014, -23255, -23495, -23731, -23961, -24184, -24397, -24598, -24785, -24955, -25107, -25239, -25349, -25436, -25499, -25538,
+        -25550,
+    },
+    {  // level 6, 8 harmonics
+        -24892, -24886, -24867, -24835, -24790, -24733, -24664, -24583, -24490, -24385, -24269, -24142, -24005, -23857, -23701, -23534,
+        -23359, -23176, -22986, -22788, -22583, -22373, -22156, -21935, -21710, -21480, -21247, -21012, -20774, -20534, -20293, -20051,
+        -19808, -19566, -19324, -19082, -18842, -18603, -18366, -18131, -17898, -17668, -17440, -17215, -16993, -16773, -16556, -16343,
+        -16132, -15924, -15719, -15517, -15317, -15120, -14925, -14732, -14541, -14352, -14165, -13979, -13794, -13610, -13426, -13243,
+        -13061, -12878, -12695, -12512, -12328, -12143, -11957, -11771, -11582, -11393, -11201, -11008, -10813, -10617, -10418, -10218,
+        -10016, -9811, -9605, -9397, -9187, -8976, -8763, -8548, -8332, -8114, -7896, -7676, -7456, -7235, -7013, -6791,
+        -6569, -6347, -6125, -5904, -5683, -5462, -5243, -5024, -4806, -4590, -4375, -4161, -3949, -3738, -3529, -3321,
+        -3115, -2911, -2708, -2507, -2307, -2109, -1912, -1717, -1523, -1330, -1138, -947, -757, -567, -378, -189,
+        0, 189, 378, 567, 757, 947, 1138, 1330, 1523, 1717, 1912, 2109, 2307, 2507, 2708, 2911,
+        3115, 3321, 3529, 3738, 3949, 4161, 4375, 4590, 4806, 5024, 5243, 5462, 5683, 5904, 6125, 6347,
+        6569, 6791, 7013, 7235, 7456, 7676, 7896, 8114, 8332, 8548, 8763, 8976, 9187, 9397, 9605, 9811,
+        10016, 10218, 10418, 10617, 10813, 11008, 11201, 11393, 11582, 11771, 11957, 12143, 12328, 12512, 12695, 12878,
+        13061, 13243, 13426, 13610, 13794, 13979, 14165, 14352, 14541, 14732, 14925, 15120, 15317, 15517, 15719, 15924,
+        16132, 16343, 16556, 16773, 16993, 17215, 17440, 17668, 17898, 18131, 18366, 18603, 18842, 19082, 19324, 19566,
+        19808, 20051, 20293, 20534, 20774, 21012, 21247, 21480, 21710, 21935, 22156, 22373, 22583, 22788, 22986, 23176,
+        23359, 23534, 23701, 23857, 24005, 24142, 24269, 24385, 24490, 24583, 24664, 24733, 24790, 24835, 24867, 24886,
+        24892, 24886, 24867, 24835, 24790, 24733, 24664, 24583, 24490, 24385, 24269, 24142, 24005, 23857, 23701, 23534,
+        23359, 23176, 22986, 22788, 22583, 22373, 22156, 21935, 21710, 21480, 21247, 21012, 20774, 20534, 20293, 20051,
+        19808, 19566, 19324, 19082, 18842, 18603, 18366, 18131, 17898, 17668, 17440, 17215, 16993, 16773, 16556, 16343,
+        16132, 15924, 15719, 15517, 15317, 15120, 14925, 14732, 14541, 14352, 14165, 13979, 13794, 13610, 13426, 13243,
+        13061, 12878, 12695, 12512, 12328, 12143, 11957, 11771, 11582, 11393, 11201, 11008, 10813, 10617, 10418, 10218,
+        10016, 9811, 9605, 9397, 9187, 8976, 8763, 8548, 8332, 8114, 7896, 7676, 7456, 7235, 7013, 6791,
+        6569, 6347, 6125, 5904, 5683, 5462, 5243, 5024, 4806, 4590, 4375, 4161, 3949, 3738, 3529, 3321,
+        3115, 2911, 2708, 2507, 2307, 2109, 1912, 1717, 1523, 1330, 1138, 947, 757, 567, 378, 189,
+        0, -189, -378, -567, -757, -947, -1138, -1330, -1523, -1717, -1912, -2109, -2307, -2507, -2708, -2911,
+        -3115, -3321, -3529, -3738, -3949, -4161, -4375, -4590, -4806, -5024, -5243, -5462, -5683, -5904, -6125, -6347,
+        -6569, -6791, -7013, -7235, -7456, -7676, -7896, -8114, -8332, -8548, -8763, -8976, -9187, -9397, -9605, -9811,
+        -10016, -10218, -10418, -10617, -10813, -11008, -11201, -11393, -11582, -11771, -11957, -12143, -12328, -12512, -12695, -12878,
+        -13061, -13243, -13426, -13610, -13794, -13979, -14165, -14352, -14541, -14732, -14925, -15120, -15317, -15517, -15719, -15924,
+        -16132, -16343, -16556, -16773, -16993, -17215, -17440, -17668, -17898, -18131, -18366, -18603, -18842, -19082, -19324, -19566,
+        -19808, -20051, -20293, -20534, -20774, -21012, -21247, -21480, -21710, -21935, -22156, -22373, -22583, -22788, -22986, -23176,
+        -23359, -23534, -23701, -23857, -24005, -24142, -24269, -24385, -24490, -24583, -24664, -24733, -24790, -24835, -24867, -24886,
+        -24892,
+    },
+    {  // level 7, 4 harmonics
+        -23609, -23606, -23596, -23580, -23558, -23529, -23494, -23453, -23405, -23351, -23291, -23225, -23152, -23074, -22989, -22899,
+        -22803, -22701, -22593, -22479, -22360, -22236, -22106, -21971, -21831, -21685, -21535, -21380, -21220, -21055, -20886, -20712,
+        -20534, -20352, -20166, -19976, -19782, -19584, -19383, -19178, -18970, -18759, -18545, -18329, -18109, -17887, -17662, -17436,
+        -17206, -16975, -16742, -16508, -16271, -16033, -15794, -15554, -15312, -15069, -14826, -14582, -14337, -14092, -13847, -13601,
+        -13355, -13109, -12864, -12618, -12373, -12128, -11884, -11640, -11397, -11155, -10914, -10674, -10435, -10196, -9959, -9724,
+        -9489, -9256, -9024, -8794, -8566, -8338, -8113, -7889, -7667, -7446, -7227, -7010, -6795, -6581, -6369, -6159,
+        -5950, -5743, -5538, -5335, -5133, -4933, -4735, -4538, -4343, -4149, -3957, -3767, -3577, -3389, -3203, -3018,
+        -2834, -2651, -2469, -2288, -2108, -1929, -1751, -1574, -1397, -1221, -1046, -871, -696, -522, -348, -174,
+        0, 174, 348, 522, 696, 871, 1046, 1221, 1397, 1574, 1751, 1929, 2108, 2288, 2469, 2651,
+        2834, 3018, 3203, 3389, 3577, 3767, 3957, 4149, 4343, 4538, 4735, 4933, 5133, 5335, 5538, 5743,
+        5950, 6159, 6369, 6581, 6795, 7010, 7227, 7446, 7667, 7889, 8113, 8338, 8566, 8794, 9024, 9256,
+        9489, 9724, 9959, 10196, 10435, 10674, 10914, 11155, 11397, 11640, 11884, 12128, 12373, 12618, 12864, 13109,
+        13355, 13601, 13847, 14092, 14337, 14582, 14826, 15069, 15312, 15554, 15794, 16033, 16271, 16508, 16742, 16975,
+        17206, 17436, 17662, 17887, 18109, 18329, 18545, 18759, 18970, 19178, 19383, 19584, 19782, 19976, 20166, 20352,
+        20534, 20712, 20886, 21055, 21220, 21380, 21535, 21685, 21831, 21971, 22106, 22236, 22360, 22479, 22593, 22701,
+        22803, 22899, 22989, 23074, 23152, 23225, 23291, 23351, 23405, 23453, 23494, 23529, 23558, 23580, 23596, 23606,
+        23609, 23606, 23596, 23580, 23558, 23529, 23494, 23453, 23405, 23351, 23291, 23225, 23152, 23074, 22989, 22899,
+        22803, 22701, 22593, 22479, 22360, 22236, 22106, 21971, 21831, 21685, 21535, 21380, 21220, 21055, 20886, 20712,
+        20534, 20352, 20166, 19976, 19782, 19584, 19383, 19178, 18970, 18759, 18545, 18329, 18109, 17887, 17662, 17436,
+        17206, 16975, 16742, 16508, 16271, 16033, 15794, 15554, 15312, 15069, 14826, 14582, 14337, 14092, 13847, 13601,
+        13355, 13109, 12864, 12618, 12373, 12128, 11884, 11640, 11397, 11155, 10914, 10674, 10435, 10196, 9959, 9724,
+        9489, 9256, 9024, 8794, 8566, 8338, 8113, 7889, 7667, 7446, 7227, 7010, 6795, 6581, 6369, 6159,
+        5950, 5743, 5538, 5335, 5133, 4933, 4735, 4538, 4343, 4149, 3957, 3767, 3577, 3389, 3203, 3018,
+        2834, 2651, 2469, 2288, 2108, 1929, 1751, 1574, 1397, 1221, 1046, 871, 696, 522, 348, 174,
+        0, -174, -348, -522, -696, -871, -1046, -1221, -1397, -1574, -1751, -1929, -2108, -2288, -2469, -2651,
+        -2834, -3018, -3203, -3389, -3577, -3767, -3957, -4149, -4343, -4538, -4735, -4933, -5133, -5335, -5538, -5743,
+        -5950, -6159, -6369, -6581, -6795, -7010, -7227, -7446, -7667, -7889, -8113, -8338, -8566, -8794, -9024, -9256,
+        -9489, -9724, -9959, -10196, -10435, -10674, -10914, -11155, -11397, -11640, -11884, -12128, -12373, -12618, -12864, -13109,
+        -13355, -13601, -13847, -14092, -14337, -14582, -14826, -15069, -15312, -15554, -15794, -16033, -16271, -16508, -16742, -16975,
+        -17206, -17436, -17662, -17887, -18109, -18329, -18545, -18759, -18970, -19178, -19383, -19584, -19782, -19976, -20166, -20352,
+        -20534, -20712, -20886, -21055, -21220, -21380, -21535, -21685, -21831, -21971, -22106, -22236, -22360, -22479, -22593, -22701,
+        -22803, -22899, -22989, -23074, -23152, -23225, -23291, -23351, -23405, -23453, -23494, -23529, -23558, -23580, -23596, -23606,
+        -23609,
+    },
+    {  // level 8, 2 harmonics
+        -21248, -21246, -21242, -21234, -21222, -21208, -21190, -21170, -21146, -21118, -21088, -21055, -21018, -20978, -20935, -20889,
+        -20840, -20787, -20732, -20673, -20611, -20546, -20478, -20407, -20333, -20256, -20176, -20092, -20006, -19917, -19824, -19729,
+        -19631, -19529, -19425, -19318, -19208, -19095, -18979, -18861, -18739, -18615, -18488, -18358, -18225, -18090, -17951, -17811,
+        -17667, -17521, -17372, -17221, -17067, -16910, -16751, -16589, -16425, -16258, -16089, -15918, -15744, -15567, -15389, -15208,
+        -15025, -14839, -14651, -14461, -14269, -14075, -13879, -13680, -13480, -13277, -13072, -12866, -12657, -12447, -12235, -12021,
+        -11805, -11587, -11368, -11146, -10924, -10699, -10473, -10245, -10016, -9786, -9553, -9320, -9085, -8848, -8611, -8372,
+        -8131, -7890, -7647, -7403, -7158, -6912, -6665, -6417, -6168, -5918, -5667, -5415, -5163, -4910, -4655, -4401,
+        -4145, -3889, -3633, -3375, -3118, -2860, -2601, -2342, -2083, -1823, -1563, -1303, -1043, -782, -521, -261,
+        0, 261, 521, 782, 1043, 1303, 1563, 1823, 2083, 2342, 2601, 2860, 3118, 3375, 3633, 3889,
+        4145, 4401, 4655, 4910, 5163, 5415, 5667, 5918, 6168, 6417, 6665, 6912, 7158, 7403, 7647, 7890,
+        8131, 8372, 8611, 8848, 9085, 9320, 9553, 9786, 10016, 10245, 10473, 10699, 10924, 11146, 11368, 11587,
+        11805, 12021, 12235, 12447, 12657, 12866, 13072, 13277, 13480, 13680, 13879, 14075, 14269, 14461, 14651, 14839,
+        15025, 15208, 15389, 15567, 15744, 15918, 16089, 16258, 16425, 16589, 16751, 16910, 17067, 17221, 17372, 17521,
+        17667, 17811, 17951, 18090, 18225, 18358, 18488, 18615, 18739, 18861, 18979, 19095, 19208, 19318, 19425, 19529,
+        19631, 19729, 19824, 19917, 20006, 20092, 20176, 20256, 20333, 20407, 20478, 20546, 20611, 20673, 20732, 20787,
+        20840, 20889, 20935, 20978, 21018, 21055, 21088, 21118, 21146, 21170, 21190, 21208, 21222, 21234, 21242, 21246,
+        21248, 21246, 21242, 21234, 21222, 21208, 21190, 21170, 21146, 21118, 21088, 21055, 21018, 20978, 20935, 20889,
+        20840, 20787, 20732, 20673, 20611, 20546, 20478, 20407, 20333, 20256, 20176, 20092, 20006, 19917, 19824, 19729,
+        19631, 19529, 19425, 19318, 19208, 19095, 18979, 18861, 18739, 18615, 18488, 18358, 18225, 18090, 17951, 17811,
+        17667, 17521, 17372, 17221, 17067, 16910, 16751, 16589, 16425, 16258, 16089, 15918, 15744, 15567, 15389, 15208,
+        15025, 14839, 14651, 14461, 14269, 14075, 13879, 13680, 13480, 13277, 13072, 12866, 12657, 12447, 12235, 12021,
+        11805, 11587, 11368, 11146, 10924, 10699, 10473, 10245, 10016, 9786, 9553, 9320, 9085, 8848, 8611, 8372,
+        8131, 7890, 7647, 7403, 7158, 6912, 6665, 6417, 6168, 5918, 5667, 5415, 5163, 4910, 4655, 4401,
+        4145, 3889, 3633, 3375, 3118, 2860, 2601, 2342, 2083, 1823, 1563, 1303, 1043, 782, 521, 261,
+        0, -261, -521, -782, -1043, -1303, -1563, -1823, -2083, -2342, -2601, -2860, -3118, -3375, -3633, -3889,
+        -4145, -4401, -4655, -4910, -5163, -5415, -5667, -5918, -6168, -6417, -6665, -6912, -7158, -7403, -7647, -7890,
+        -8131, -8372, -8611, -8848, -9085, -9320, -9553, -9786, -10016, -10245, -10473, -10699, -10924, -11146, -11368, -11587,
+        -11805, -12021, -12235, -12447, -12657, -12866, -13072, -13277, -13480, -13680, -13879, -14075, -14269, -14461, -14651, -14839,
+        -15025, -15208, -15389, -15567, -15744, -15918, -16089, -16258, -16425, -16589, -16751, -16910, -17067, -17221, -17372, -17521,
+        -17667, -17811, -17951, -18090, -18225, -18358, -18488, -18615, -18739, -18861, -18979, -19095, -19208, -19318, -19425, -19529,
+        -19631, -19729, -19824, -19917, -20006, -20092, -20176, -20256, -20333, -20407, -20478, -20546, -20611, -20673, -20732, -20787,
+        -20840, -20889, -20935, -20978, -21018, -21055, -21088, -21118, -21146, -21170, -21190, -21208, -21222, -21234, -21242, -21246,
+        -21248,
+    },
+    {  // level 9, 1 harmonics
+        -21248, -21246, -21242, -21234, -21222, -21208, -21190, -21170, -21146, -21118, -21088, -21055, -21018, -20978, -20935, -20889,
+        -20840, -20787, -20732, -20673, -20611, -20546, -20478, -20407, -20333, -20256, -20176, -20092, -20006, -19917, -19824, -19729,
+        -19631, -19529, -19425, -19318, -19208, -19095, -18979, -18861, -18739, -18615, -18488, -18358, -18225, -18090, -17951, -17811,
+        -17667, -17521, -17372, -17221, -17067, -16910, -16751, -16589, -16425, -16258, -16089, -15918, -15744, -15567, -15389, -15208,
+        -15025, -14839, -14651, -14461, -14269, -14075, -13879, -13680, -13480, -13277, -13072, -12866, -12657, -12447, -12235, -12021,
+        -11805, -11587, -11368, -11146, -10924, -10699, -10473, -10245, -10016, -9786, -9553, -9320, -9085, -8848, -8611, -8372,
+        -8131, -7890, -7647, -7403, -7158, -6912, -6665, -6417, -6168, -5918, -5667, -5415, -5163, -4910, -4655, -4401,
+        -4145, -3889, -3633, -3375, -3118, -2860, -2601, -2342, -2083, -1823, -1563, -1303, -1043, -782, -521, -261,
+        0, 261, 521, 782, 1043, 1303, 1563, 1823, 2083, 2342, 2601, 2860, 3118, 3375, 3633, 3889,
+        4145, 4401, 4655, 4910, 5163, 5415, 5667, 5918, 6168, 6417, 6665, 6912, 7158, 7403, 7647, 7890,
+        8131, 8372, 8611, 8848, 9085, 9320, 9553, 9786, 10016, 10245, 10473, 10699, 10924, 11146, 11368, 11587,
+        11805, 12021, 12235, 12447, 12657, 12866, 13072, 13277, 13480, 13680, 13879, 14075, 14269, 14461, 14651, 14839,
+        15025, 15208, 15389, 15567, 15744, 15918, 16089, 16258, 16425, 16589, 16751, 16910, 17067, 17221, 17372, 17521,
+        17667, 17811, 17951, 18090, 18225, 18358, 18488, 18615, 18739, 18861, 18979, 19095, 19208, 19318, 19425, 19529,
+        19631, 19729, 19824, 19917, 20006, 20092, 20176, 20256, 20333, 20407, 20478, 20546, 20611, 20673, 20732, 20787,
+        20840, 20889, 20935, 20978, 21018, 21055, 21088, 21118, 21146, 21170, 21190, 21208, 21222, 21234, 21242, 21246,
+        21248, 21246, 21242, 21234, 21222, 21208, 21190, 21170, 21146, 21118, 21088, 21055, 21018, 20978, 20935, 20889,
+        20840, 20787, 20732, 20673, 20611, 20546, 20478, 20407, 20333, 20256, 20176, 20092, 20006, 19917, 19824, 19729,
+        19631, 19529, 19425, 19318, 19208, 19095, 18979, 18861, 18739, 18615, 18488, 18358, 18225, 18090, 17951, 17811,
+        17667, 17521, 17372, 17221, 17067, 16910, 16751, 16589, 16425, 16258, 16089, 15918, 15744, 15567, 15389, 15208,
+        15025, 14839, 14651, 14461, 14269, 14075, 13879, 13680, 13480, 13277, 13072, 12866, 12657, 12447, 12235, 12021,
+        11805, 11587, 11368, 11146, 10924, 10699, 10473, 10245, 10016, 9786, 9553, 9320, 9085, 8848, 8611, 8372,
+        8131, 7890, 7647, 7403, 7158, 6912, 6665, 6417, 6168, 5918, 5667, 5415, 5163, 4910, 4655, 4401,
+        4145, 3889, 3633, 3375, 3118, 2860, 2601, 2342, 2083, 1823, 1563, 1303, 1043, 782, 521, 261,
+        0, -261, -521, -782, -1043, -1303, -1563, -1823, -2083, -2342, -2601, -2860, -3118, -3375, -3633, -3889,
+        -4145, -4401, -4655, -4910, -5163, -5415, -5667, -5918, -6168, -6417, -6665, -6912, -7158, -7403, -7647, -7890,
+        -8131, -8372, -8611, -8848, -9085, -9320, -9553, -9786, -10016, -10245, -10473, -10699, -10924, -11146, -11368, -11587,
+        -11805, -12021, -12235, -12447, -12657, -12866, -13072, -13277, -13480, -13680, -13879, -14075, -14269, -14461, -14651, -14839,
+        -15025, -15208, -15389, -15567, -15744, -15918, -16089, -16258, -16425, -16589, -16751, -16910, -17067, -17221, -17372, -17521,
+        -17667, -17811, -17951, -18090, -18225, -18358, -18488, -18615, -18739, -18861, -18979, -19095, -19208, -19318, -19425, -19529,
+        -19631, -19729, -19824, -19917, -20006, -20092, -20176, -20256, -20333, -20407, -20478, -20546, -20611, -20673, -20732, -20787,
+        -20840, -20889, -20935, -20978, -21018, -21055, -21088, -21118, -21146, -21170, -21190, -21208, -21222, -21234, -21242, -21246,
+        -21248,
+    },
+};
+
+}  // namespace dsp
+}  // namespace beca